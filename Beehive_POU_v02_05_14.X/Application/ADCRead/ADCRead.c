@@ -12,6 +12,11 @@ Description:
   This class is responsible for reading all the 4 analog input channels one by
   one periodically. It will read the converted data and process it.
 
+  When ADCREAD_DMA_SCAN is defined, all the 8 channels are converted in every
+  10 ms by the DMA driven scan and ADCRead() processes the latest scan buffer.
+  When ADCREAD_OVERSAMPLING is defined, the thermistor channels are converted
+  16 times in the scan and decimated to 14 bits.
+
 Class Methods:
   void ADCRead(void);
     Call periodically from Scheduler (125msec), to trigger the ADC conversion of
@@ -19,175 +24,1559 @@ Class Methods:
     converted data and checks the minimum maximum ranges for thermistors digital
     data, Moisture detectors digital value and power supply voltage also.
 
-Method Calling Requirements:
-  adcRead.ReadFunction() should be called once per 1 second in scheduler.
+  bool ADCReadSetFilter(uint8_t channelIndex, uint8_t type, uint8_t length);
+    Changes the filter of one channel in the filter bank.
+
+  int16_t ADCReadSlope(uint8_t channelIndex, uint16_t windowW);
+    Returns the least squares slope of a thermistor channel over the window.
+
+  void ADCReadLoadCalibration(void);
+    Loads the self calibration stored with the settings.
+
+Method Calling Requirements:
+  adcRead.ReadFunction() should be called once per 1 second in scheduler.
+
+Resources:
+  8 ADC channel inputs
+
+IoTranslate requirements:
+  The following #defines are used in ADC read operation.
+
+  #define ADCREAD_CHANNEL_SELECT(ChannelIndex)
+  #define ADCREAD_START_SAMPLING()
+  #define ADCREAD_CONVERSION_COMPLETE()
+  #define ADCREAD_READ_REGISTER()
+
+  The following functions are used in ADC read operation.
+  ADCReadTriggerDischarge()
+  ADCReadStopDischarge()
+  ADCReadProbeStart()
+  ADCReadProbeEnd()
+  
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+       09-24-2019  Initial Write                            Poorana kumar G
+       11-04-2019  PC-Lint warning is cleared by adding     Poorana kumar G
+                   "static" in "LowPassFilter" function.
+1.1.0  02-04-2020  As per the Beta requirement changes      Poorana kumar G
+                   updated the functions
+2.2.0  07-16-2020  Macro to disable the inlet temperature   Poorana kumar G
+                   ADC conversion is added.
+2.3.0  09-15-2020  Averaging is made common for all the     Poorana kumar G
+                   analog channels 
+2.6.0  10-16-2026  Scan complete event is signalled to the
+                   scheduler.
+2.6.0  10-16-2026  DMA driven scan of all the channels is
+                   added.
+2.6.0  10-16-2026  Filter of each channel is selected from
+                   the IIR, moving average and median.
+2.6.0  10-16-2026  Thermistor pin probe does not wait for
+                   the IO level, it is read on a later scan.
+2.6.0  10-16-2026  Channels are converted in the order of
+                   the schedule selected by the heater state.
+2.6.0  10-16-2026  Thermistor samples are kept with their
+                   tick count for the least squares slope.
+2.6.0  10-16-2026  Implausible chamber thermistor readings
+                   are held till confirmed.
+2.6.0  10-16-2026  Channels are described by a descriptor
+                   table. Chamber thermistors fitted after
+                   power ON are detected.
+2.6.0  10-16-2026  Raw counts are corrected by the offset &
+                   gain self calibration.
+2.6.0  10-16-2026  Thermistor channels are oversampled in
+                   the DMA scan.
+2.6.0  10-16-2026  Thermistor data is compensated for the
+                   thermal lag.
+2.6.0  10-16-2026  Moving average and the new biquad filter
+                   use the DSP kernels.
+--------------------------------------------------------------------------------
+*/
+
+#include "ADCRead.h"
+#include "TemperatureControl.h"
+#include "DSPKernel.h"
+
+#if (defined ADCREAD_DMA_SCAN) &&                                         \
+        (ADC_DMA_CONVERSION_COUNTS < ADC_DMA_MIN_CONVERSION_COUNTS)
+#error "ADC_DMA_SCAN_CONVERSIONS leave too short sampling in the DMA scan"
+#endif
+
+// Descriptor of the channels to be converted, in the ADC array index order
+const ADCChannel_STYP adcChannelARY[TOTAL_ADC_CHANNELS] =
+{
+  {ADC1_INLET_TEMPERATURE_ADC, ADC_ROLE_PIPE_THERMISTOR,
+          THERMISTOR_OPEN_ADC_COUNT, THERMISTOR_SHORT_ADC_COUNT,
+          THERMISTOR1_OPEN_ERROR, THERMISTOR1_SHORT_ERROR, ADC_LAG_TAU_PIPE},
+  {ADC1_OUTLET_TEMPERATURE_ADC, ADC_ROLE_PIPE_THERMISTOR,
+          THERMISTOR_OPEN_ADC_COUNT, THERMISTOR_SHORT_ADC_COUNT,
+          THERMISTOR2_OPEN_ERROR, THERMISTOR2_SHORT_ERROR, ADC_LAG_TAU_PIPE},
+  {ADC1_CHAMBER_TEMPERATURE1, ADC_ROLE_CHAMBER_THERMISTOR,
+          THERMISTOR_OPEN_ADC_COUNT, THERMISTOR_SHORT_ADC_COUNT,
+          THERMISTOR3_OPEN_ERROR, THERMISTOR3_SHORT_ERROR, ADC_LAG_TAU_CHAMBER},
+  {ADC1_CHAMBER_TEMPERATURE2, ADC_ROLE_CHAMBER_THERMISTOR,
+          THERMISTOR_OPEN_ADC_COUNT, THERMISTOR_SHORT_ADC_COUNT,
+          THERMISTOR4_OPEN_ERROR, THERMISTOR4_SHORT_ERROR, ADC_LAG_TAU_CHAMBER},
+  {ADC1_CHAMBER_TEMPERATURE3, ADC_ROLE_CHAMBER_THERMISTOR,
+          THERMISTOR_OPEN_ADC_COUNT, THERMISTOR_SHORT_ADC_COUNT,
+          THERMISTOR5_OPEN_ERROR, THERMISTOR5_SHORT_ERROR, ADC_LAG_TAU_CHAMBER},
+  {ADC1_CHAMBER_TEMPERATURE4, ADC_ROLE_CHAMBER_THERMISTOR,
+          THERMISTOR_OPEN_ADC_COUNT, THERMISTOR_SHORT_ADC_COUNT,
+          THERMISTOR6_OPEN_ERROR, THERMISTOR6_SHORT_ERROR, ADC_LAG_TAU_CHAMBER},
+  {ADC1_MOISTURE_DETECT_ADC, ADC_ROLE_MOISTURE,
+          MOISTURE_DETECTOR_LEAK_COUNT, MOISTURE_DETECTOR_UPPER_THRESHOLD,
+          LEAKAGE_ERROR, LEAKAGE_ERROR, 0},
+  {ADC1_VCC_VOLTAGE_ADC, ADC_ROLE_SUPPLY,
+          POWER_SUPPLY_ADC_COUNT - ((POWER_SUPPLY_ADC_COUNT * POWER_SUPPLY_TOLERANCE) / 100),
+          POWER_SUPPLY_ADC_COUNT + ((POWER_SUPPLY_ADC_COUNT * POWER_SUPPLY_TOLERANCE) / 100),
+          DC_SUPPLY_ERROR, DC_SUPPLY_ERROR, 0},
+};
+
+// Q14 coefficients of the biquad cutoffs, second order Butterworth low pass
+// with the DC gain of exactly 1
+static const int16_t adcBiquadARYW[ADC_FILTER_BIQUAD_CUTOFFS][DSP_BIQUAD_COEFFICIENTS] =
+{
+  {1600, 3198, 1600, 15447, -5461},     // 1/8 of the sample rate
+  {491, 981, 491, 23826, -9405}         // 1/16 of the sample rate
+};
+
+#ifdef ADCREAD_DMA_SCAN
+// Ping-pong buffers filled by the DMA scan
+static volatile uint16_t adcScanBufferARYW[2][ADC_DMA_SCAN_CONVERSIONS];
+
+// Input of each conversion written by the DMA into the ADC input select
+static uint16_t adcScanInputARYW[ADC_DMA_SCAN_CONVERSIONS];
+#else
+// Channel schedules, one row per scan. While heating, the freed moisture
+// detector & power supply slots are given to the outlet & chamber thermistors.
+#ifdef DISABLE_INLET_THERMISTOR
+static const uint8_t adcIdleScheduleARY[] =
+{
+  OUTLET_TEMPERATURE, CHAMBER_TEMPERATURE1, CHAMBER_TEMPERATURE2, CHAMBER_TEMPERATURE3, CHAMBER_TEMPERATURE4, MOISTURE_DETECTOR, VCC_VOLTAGE,
+  OUTLET_TEMPERATURE, CHAMBER_TEMPERATURE1, CHAMBER_TEMPERATURE2, CHAMBER_TEMPERATURE3, CHAMBER_TEMPERATURE4, MOISTURE_DETECTOR, VCC_VOLTAGE,
+  OUTLET_TEMPERATURE, CHAMBER_TEMPERATURE1, CHAMBER_TEMPERATURE2, CHAMBER_TEMPERATURE3, CHAMBER_TEMPERATURE4, MOISTURE_DETECTOR, VCC_VOLTAGE,
+  OUTLET_TEMPERATURE, CHAMBER_TEMPERATURE1, CHAMBER_TEMPERATURE2, CHAMBER_TEMPERATURE3, CHAMBER_TEMPERATURE4, MOISTURE_DETECTOR, VCC_VOLTAGE,
+};
+
+static const uint8_t adcHeatingScheduleARY[] =
+{
+  OUTLET_TEMPERATURE, CHAMBER_TEMPERATURE1, CHAMBER_TEMPERATURE2, CHAMBER_TEMPERATURE3, CHAMBER_TEMPERATURE4, OUTLET_TEMPERATURE, MOISTURE_DETECTOR,
+  CHAMBER_TEMPERATURE1, CHAMBER_TEMPERATURE2, CHAMBER_TEMPERATURE3, CHAMBER_TEMPERATURE4, OUTLET_TEMPERATURE, CHAMBER_TEMPERATURE1, CHAMBER_TEMPERATURE2,
+  CHAMBER_TEMPERATURE3, CHAMBER_TEMPERATURE4, OUTLET_TEMPERATURE, CHAMBER_TEMPERATURE1, CHAMBER_TEMPERATURE2, CHAMBER_TEMPERATURE3, VCC_VOLTAGE,
+  CHAMBER_TEMPERATURE4, OUTLET_TEMPERATURE, CHAMBER_TEMPERATURE1, CHAMBER_TEMPERATURE2, CHAMBER_TEMPERATURE3, CHAMBER_TEMPERATURE4, OUTLET_TEMPERATURE,
+};
+#else
+static const uint8_t adcIdleScheduleARY[] =
+{
+  INLET_TEMPERATURE, OUTLET_TEMPERATURE, CHAMBER_TEMPERATURE1, CHAMBER_TEMPERATURE2, CHAMBER_TEMPERATURE3, CHAMBER_TEMPERATURE4, MOISTURE_DETECTOR, VCC_VOLTAGE,
+  INLET_TEMPERATURE, OUTLET_TEMPERATURE, CHAMBER_TEMPERATURE1, CHAMBER_TEMPERATURE2, CHAMBER_TEMPERATURE3, CHAMBER_TEMPERATURE4, MOISTURE_DETECTOR, VCC_VOLTAGE,
+  INLET_TEMPERATURE, OUTLET_TEMPERATURE, CHAMBER_TEMPERATURE1, CHAMBER_TEMPERATURE2, CHAMBER_TEMPERATURE3, CHAMBER_TEMPERATURE4, MOISTURE_DETECTOR, VCC_VOLTAGE,
+  INLET_TEMPERATURE, OUTLET_TEMPERATURE, CHAMBER_TEMPERATURE1, CHAMBER_TEMPERATURE2, CHAMBER_TEMPERATURE3, CHAMBER_TEMPERATURE4, MOISTURE_DETECTOR, VCC_VOLTAGE,
+};
+
+static const uint8_t adcHeatingScheduleARY[] =
+{
+  INLET_TEMPERATURE, OUTLET_TEMPERATURE, CHAMBER_TEMPERATURE1, CHAMBER_TEMPERATURE2, CHAMBER_TEMPERATURE3, CHAMBER_TEMPERATURE4, OUTLET_TEMPERATURE, MOISTURE_DETECTOR,
+  INLET_TEMPERATURE, CHAMBER_TEMPERATURE1, CHAMBER_TEMPERATURE2, CHAMBER_TEMPERATURE3, CHAMBER_TEMPERATURE4, OUTLET_TEMPERATURE, CHAMBER_TEMPERATURE1, CHAMBER_TEMPERATURE2,
+  INLET_TEMPERATURE, CHAMBER_TEMPERATURE3, CHAMBER_TEMPERATURE4, OUTLET_TEMPERATURE, CHAMBER_TEMPERATURE1, CHAMBER_TEMPERATURE2, CHAMBER_TEMPERATURE3, VCC_VOLTAGE,
+  INLET_TEMPERATURE, CHAMBER_TEMPERATURE4, OUTLET_TEMPERATURE, CHAMBER_TEMPERATURE1, CHAMBER_TEMPERATURE2, CHAMBER_TEMPERATURE3, CHAMBER_TEMPERATURE4, OUTLET_TEMPERATURE,
+};
+#endif
+
+// Compile time check of the schedule length
+typedef char ADCIdleScheduleCheck_TYP[                                    \
+        (sizeof(adcIdleScheduleARY) == ADC_SCHEDULE_SLOTS) ? 1 : -1];
+typedef char ADCHeatingScheduleCheck_TYP[                                 \
+        (sizeof(adcHeatingScheduleARY) == ADC_SCHEDULE_SLOTS) ? 1 : -1];
+#endif
+
+
+/*
+================================================================================
+Method name:  LowPassFilter
+                    
+Originator:   Poorana kumar G
+
+Description: 
+  The purpose of this function is used to do the low pass filter operation on
+  ADC's output.
+
+  This is an inline function and this method should be called using
+  LowPassFilter().
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+       10-14-2019  Initial Write                        Poorana kumar G
+       11-04-2019  PC-Lint warning is cleared by        Poorana kumar G
+                   adding "static".
+2.6.0  10-16-2026  Shift is passed by the filter bank.
+2.6.0  10-16-2026  Filter register is 32 bits for the
+                   oversampled data.
+--------------------------------------------------------------------------------
+*/
+
+static inline uint16_t LowPassFilter(uint32_t *filterRegPTRL, uint16_t rawDataW,
+        uint8_t shifts)
+{
+  if ( *filterRegPTRL != 0) {
+    // Allow the 1/2^shifts of the change in ADC count.
+    (*filterRegPTRL) -= (*filterRegPTRL >> shifts);
+    (*filterRegPTRL) += rawDataW;
+  }
+  else {
+    // Initialize the filter register.
+    (*filterRegPTRL) = ((uint32_t) rawDataW << shifts);
+  }
+
+  return (uint16_t) ((*filterRegPTRL) >> shifts);
+}
+
+
+/*
+================================================================================
+Method name:  ADCFilterStore
+                    
+Originator:   
+
+Description: 
+  The purpose of this function is to store the sample into the history of the
+  channel, which holds the last length samples. It returns the sample dropped
+  from the history, or 0 while the history is filling.
+
+  This method should be called using ADCFilterStore().
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+static uint16_t ADCFilterStore(uint8_t channelIndex, uint16_t rawDataW,
+        uint8_t length)
+{
+  uint8_t index = adcRead.filterIndexARY[channelIndex];
+  uint16_t droppedW = 0;
+
+  if ( adcRead.filterCountARY[channelIndex] < length) {
+    adcRead.filterCountARY[channelIndex]++;
+  }
+  else {
+    droppedW = adcRead.filterHistoryARYW[channelIndex][index];
+  }
+  adcRead.filterHistoryARYW[channelIndex][index] = rawDataW;
+
+  index++;
+  if ( index >= length) {
+    index = 0;
+  }
+  adcRead.filterIndexARY[channelIndex] = index;
+
+  return droppedW;
+}
+
+
+/*
+================================================================================
+Method name:  MovingAverage
+                    
+Originator:   
+
+Description: 
+  The purpose of this function is to average the last taps samples of the
+  channel. The samples are weighted by the reciprocal of their count and summed
+  in the DSP accumulator, so no running sum or division is needed.
+
+  This is an inline function and this method should be called using
+  MovingAverage().
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+2.6.0  10-16-2026  Running sum is 32 bits.
+2.6.0  10-16-2026  Average is the DSP moving average of the
+                   history.
+--------------------------------------------------------------------------------
+*/
+
+static inline uint16_t MovingAverage(uint8_t channelIndex, uint16_t rawDataW,
+        uint8_t taps)
+{
+  (void)ADCFilterStore(channelIndex, rawDataW, taps);
+
+  // Data is 14 bits at most, a positive Q15 number
+  return (uint16_t) DSPMovingAverage(                                   \
+          (const int16_t *) adcRead.filterHistoryARYW[channelIndex],    \
+          adcRead.filterCountARY[channelIndex]);
+}
+
+
+/*
+================================================================================
+Method name:  MedianFilter
+                    
+Originator:   
+
+Description: 
+  The purpose of this function is to return the median of the last points
+  samples of the channel. The samples are copied and sorted by insertion, which
+  is short for 3 or 5 points.
+
+  This is an inline function and this method should be called using
+  MedianFilter().
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+static inline uint16_t MedianFilter(uint8_t channelIndex, uint16_t rawDataW,
+        uint8_t points)
+{
+  uint16_t sortedARYW[ADC_FILTER_MAX_TAPS];
+  uint16_t sampleW;
+  uint8_t count, index, position;
+
+  (void)ADCFilterStore(channelIndex, rawDataW, points);
+  count = adcRead.filterCountARY[channelIndex];
+
+  for ( index = 0; index < count; index++) {
+    sampleW = adcRead.filterHistoryARYW[channelIndex][index];
+    position = index;
+    while ( (position > 0) && (sortedARYW[position - 1] > sampleW)) {
+      sortedARYW[position] = sortedARYW[position - 1];
+      position--;
+    }
+    sortedARYW[position] = sampleW;
+  }
+
+  return sortedARYW[count / 2];
+}
+
+
+/*
+================================================================================
+Method name:  BiquadFilter
+                    
+Originator:   
+
+Description: 
+  The purpose of this function is to filter the sample of the channel by the
+  biquad section of the cutoff. The first 4 history entries of the channel are
+  the state of the section, which is set to the first sample so the output
+  starts from it.
+
+  This is an inline function and this method should be called using
+  BiquadFilter().
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+static inline uint16_t BiquadFilter(uint8_t channelIndex, uint16_t rawDataW,
+        uint8_t cutoff)
+{
+  int16_t *statePTR = (int16_t *) adcRead.filterHistoryARYW[channelIndex];
+  uint8_t index;
+  int16_t outputW;
+
+  if ( adcRead.filterCountARY[channelIndex] == 0) {
+    for ( index = 0; index < DSP_BIQUAD_STATES; index++) {
+      statePTR[index] = (int16_t) rawDataW;
+    }
+    adcRead.filterCountARY[channelIndex] = 1;
+  }
+
+  outputW = DSPBiquad(statePTR, adcBiquadARYW[cutoff - 1], (int16_t) rawDataW);
+
+  // Overshoot below zero is not a count
+  return (outputW > 0) ? (uint16_t) outputW : 0;
+}
+
+
+/*
+================================================================================
+Method name:  ADCReadFilter
+                    
+Originator:   
+
+Description: 
+  The purpose of this function is to filter the converted data with the filter
+  selected for the channel in the filter bank.
+
+  The moving average and the biquad are sums of products and use the DSP
+  kernels. The IIR is a shift and a subtract on its 32 bit register and the
+  median only compares the samples, so they have no product for MAC and are
+  done in C.
+
+  This method should be called using ADCReadFilter().
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+2.6.0  10-16-2026  Biquad filter is added.
+--------------------------------------------------------------------------------
+*/
+
+static uint16_t ADCReadFilter(uint8_t channelIndex, uint16_t rawDataW)
+{
+  const ADCFilter_STYP *filterPTR = &adcRead.filterBankARY[channelIndex];
+  uint16_t filteredW;
+
+  switch ( filterPTR->type) {
+    case ADC_FILTER_AVERAGE:
+      filteredW = MovingAverage(channelIndex, rawDataW, filterPTR->length);
+      break;
+
+    case ADC_FILTER_MEDIAN:
+      filteredW = MedianFilter(channelIndex, rawDataW, filterPTR->length);
+      break;
+
+    case ADC_FILTER_BIQUAD:
+      filteredW = BiquadFilter(channelIndex, rawDataW, filterPTR->length);
+      break;
+
+    case ADC_FILTER_IIR:
+    default:
+      filteredW = LowPassFilter(&adcRead.adcDataFilterARYL[channelIndex],
+              rawDataW, filterPTR->length);
+      break;
+  }
+
+  return filteredW;
+}
+
+
+/*
+================================================================================
+Method name:  ADCReadSetFilter
+                    
+Originator:   
+
+Description: 
+  The purpose of this function is to change the filter of one channel. The
+  IIR shift is 1 to ADC_FILTER_MAX_SHIFTS, the moving average taps are 1 to
+  ADC_FILTER_MAX_TAPS, the median points are 3 or 5 and the biquad cutoff is 1
+  to ADC_FILTER_BIQUAD_CUTOFFS. The filter of the channel starts again from the
+  next sample. Returns false and keeps the current filter when the arguments
+  are not valid.
+
+  This method should be called using adcRead.SetFilter().
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+2.6.0  10-16-2026  Biquad cutoff is checked.
+--------------------------------------------------------------------------------
+*/
+
+bool ADCReadSetFilter(uint8_t channelIndex, uint8_t type, uint8_t length)
+{
+  bool validFLG = false;
+
+  if ( channelIndex < TOTAL_ADC_CHANNELS) {
+    switch ( type) {
+      case ADC_FILTER_IIR:
+        validFLG = (length >= 1) && (length <= ADC_FILTER_MAX_SHIFTS);
+        break;
+
+      case ADC_FILTER_AVERAGE:
+        validFLG = (length >= 1) && (length <= ADC_FILTER_MAX_TAPS);
+        break;
+
+      case ADC_FILTER_MEDIAN:
+        validFLG = (length == 3) || (length == 5);
+        break;
+
+      case ADC_FILTER_BIQUAD:
+        validFLG = (length >= 1) && (length <= ADC_FILTER_BIQUAD_CUTOFFS);
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  if ( validFLG == true) {
+    adcRead.filterBankARY[channelIndex].type = type;
+    adcRead.filterBankARY[channelIndex].length = length;
+    // Restart the filter, the output holds the last value till the next sample
+    adcRead.adcDataFilterARYL[channelIndex] = 0;
+    adcRead.filterIndexARY[channelIndex] = 0;
+    adcRead.filterCountARY[channelIndex] = 0;
+  }
+
+  return validFLG;
+}
+
+
+/*
+================================================================================
+Method name:  ADCReadRecord
+                    
+Originator:   
+
+Description: 
+  The purpose of this function is to put the filtered data of the thermistor
+  channel, in ADC fine units, into its sample history with the present tick
+  count. The entry is skipped if the last entry is newer than
+  ADC_HISTORY_PERIOD, so the history covers the same time for the DMA scan and
+  the one channel per pass read. Returns true if the entry is added.
+
+  This method should be called using ADCReadRecord().
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+2.6.0  10-16-2026  Data is passed in ADC fine units.
+2.6.0  10-16-2026  Returns whether the entry is added.
+--------------------------------------------------------------------------------
+*/
+
+static bool ADCReadRecord(uint8_t channelIndex, uint16_t fineW)
+{
+  bool recordedFLG = false;
+  uint16_t tickW = scheduler.tickCountW;
+  uint8_t head = adcRead.historyHeadARY[channelIndex];
+  uint8_t last = (head - 1) & (ADC_HISTORY_SIZE - 1);
+
+  if ( (adcRead.historyCountARY[channelIndex] == 0) ||                  \
+          ((uint16_t) (tickW - adcRead.historyARY[channelIndex][last].tickW) >= \
+          ADC_HISTORY_PERIOD)) {
+    adcRead.historyARY[channelIndex][head].tickW = tickW;
+    adcRead.historyARY[channelIndex][head].dataW = fineW;
+    adcRead.historyHeadARY[channelIndex] = (head + 1) & (ADC_HISTORY_SIZE - 1);
+
+    if ( adcRead.historyCountARY[channelIndex] < ADC_HISTORY_SIZE) {
+      adcRead.historyCountARY[channelIndex]++;
+    }
+    recordedFLG = true;
+  }
+
+  return recordedFLG;
+}
+
+
+/*
+================================================================================
+Method name:  ADCReadSlope
+                    
+Originator:   
+
+Description: 
+  The purpose of this function is to return the least squares slope of the
+  thermistor channel in ADC half units per second. The history entries of the
+  past windowW ms are used, at least the 2 newest ones. Returns 0 if there are
+  not 2 entries newer than ADC_HISTORY_MAX_AGE.
+
+  The times and data are taken relative to the newest entry and the times are
+  centred on their mean, so the sums fit in 32 bits. The data is in ADC fine
+  units, so the oversampling bits below the half unit are used by the fit.
+
+  This method should be called using adcRead.Slope().
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+2.6.0  10-16-2026  History is in ADC fine units.
+--------------------------------------------------------------------------------
+*/
+
+int16_t ADCReadSlope(uint8_t channelIndex, uint16_t windowW)
+{
+  int16_t timeARYW[ADC_HISTORY_SIZE];
+  int16_t dataARYW[ADC_HISTORY_SIZE];
+  uint16_t nowW = scheduler.tickCountW;
+  uint16_t ageW;
+  uint16_t newestW = 0;
+  uint8_t entry;
+  uint8_t count = 0;
+  uint8_t index;
+  int16_t meanTimeW;
+  int16_t deltaTimeW;
+  int32_t sumTimeL = 0;
+  int32_t numeratorL = 0;
+  int32_t denominatorL = 0;
+  int32_t slopeL = 0;
+
+  if ( channelIndex < TOTAL_THERMISTORS) {
+    entry = adcRead.historyHeadARY[channelIndex];
+
+    // Collect the entries from the newest one
+    while ( count < adcRead.historyCountARY[channelIndex]) {
+      entry = (entry - 1) & (ADC_HISTORY_SIZE - 1);
+      ageW = nowW - adcRead.historyARY[channelIndex][entry].tickW;
+
+      if ( (ageW > ADC_HISTORY_MAX_AGE) ||                              \
+              ((count >= 2) && (ageW > windowW))) {
+        break;
+      }
+      if ( count == 0) {
+        newestW = adcRead.historyARY[channelIndex][entry].dataW;
+      }
+
+      timeARYW[count] = -(int16_t) ageW;
+      dataARYW[count] = (int16_t) (adcRead.historyARY[channelIndex][entry].dataW - \
+              newestW);
+      sumTimeL += timeARYW[count];
+      count++;
+    }
+
+    if ( count >= 2) {
+      meanTimeW = (int16_t) (sumTimeL / count);
+
+      for ( index = 0; index < count; index++) {
+        deltaTimeW = timeARYW[index] - meanTimeW;
+        numeratorL += (int32_t) deltaTimeW * dataARYW[index];
+        denominatorL += (int32_t) deltaTimeW * deltaTimeW;
+      }
+
+      if ( denominatorL != 0) {
+        // Fine units per ms to half units per second
+        slopeL = (int32_t) (((int64_t) numeratorL * 1000) /             \
+                ((int64_t) denominatorL << ADC_FINE_SHIFT));
+
+        if ( slopeL > INT16_MAX) {
+          slopeL = INT16_MAX;
+        }
+        else if ( slopeL < INT16_MIN) {
+          slopeL = INT16_MIN;
+        }
+      }
+    }
+  }
+
+  return (int16_t) slopeL;
+}
+
+
+#ifdef ADCREAD_LAG_COMPENSATION
+/*
+================================================================================
+Method name:  ADCReadLead
+                    
+Originator:   
+
+Description: 
+  The purpose of this function is to return the lead of the thermistor channel
+  in ADC half units. The thermistor follows the water with a first order lag,
+  so the water temperature is the thermistor temperature plus the time
+  constant times its rate of change. The rate is the slope over
+  ADC_LAG_SLOPE_WINDOW, which filters the noise the derivative would add, and
+  the lead is limited to ADC_LAG_MAX_LEAD.
+
+  This method should be called using ADCReadLead().
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+static int16_t ADCReadLead(uint8_t channelIndex)
+{
+  int32_t leadL;
+
+  // Half units per second x ms
+  leadL = ((int32_t) ADCReadSlope(channelIndex, ADC_LAG_SLOPE_WINDOW) * \
+          adcChannelARY[channelIndex].lagTauW) / 1000;
+
+  if ( leadL > ADC_LAG_MAX_LEAD) {
+    leadL = ADC_LAG_MAX_LEAD;
+  }
+  else if ( leadL < -ADC_LAG_MAX_LEAD) {
+    leadL = -ADC_LAG_MAX_LEAD;
+  }
+
+  return (int16_t) leadL;
+}
+
+
+/*
+================================================================================
+Method name:  ADCReadCompensated
+                    
+Originator:   
+
+Description: 
+  The purpose of this function is to return the thermistor data with the lead
+  added. The data out of the open & short counts is returned as it is, so the
+  thermistor errors are seen by the users of the compensated data, and the
+  compensated data is kept in between these counts.
+
+  This method should be called using ADCReadCompensated().
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+static uint16_t ADCReadCompensated(uint8_t channelIndex)
+{
+  const ADCChannel_STYP *channelPTR = &adcChannelARY[channelIndex];
+  uint16_t dataW = adcRead.adcDataARYW[channelIndex];
+  int32_t estimateL;
+
+  if ( (dataW < channelPTR->lowCountW) || (dataW > channelPTR->highCountW)) {
+    return dataW;
+  }
+
+  estimateL = (int32_t) dataW + adcRead.leadARYW[channelIndex];
+
+  if ( estimateL < (int32_t) channelPTR->lowCountW) {
+    estimateL = channelPTR->lowCountW;
+  }
+  else if ( estimateL > (int32_t) channelPTR->highCountW) {
+    estimateL = channelPTR->highCountW;
+  }
+
+  return (uint16_t) estimateL;
+}
+#endif
+
+
+#ifdef ADCREAD_PLAUSIBILITY
+/*
+================================================================================
+Method name:  ADCReadPeerMedian
+                    
+Originator:   
+
+Description: 
+  The purpose of this function is to return the median of the outlet and the
+  other detected chamber thermistors, the peers of the chamber thermistor.
+
+  This method should be called using ADCReadPeerMedian().
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+static uint16_t ADCReadPeerMedian(uint8_t channelIndex)
+{
+  uint16_t peerARYW[ADC_CHAMBER_CHANNELS];
+  uint16_t dataW;
+  uint8_t count = 0;
+  uint8_t peerIndex;
+  uint8_t position;
+
+  for ( peerIndex = OUTLET_TEMPERATURE; peerIndex <= CHAMBER_TEMPERATURE4; peerIndex++) {
+    if ( (peerIndex == OUTLET_TEMPERATURE) ||                            \
+            ((peerIndex != channelIndex) &&                             \
+            ADCREAD_DETECTED(peerIndex))) {
+      // Insert in the ascending order
+      dataW = adcRead.adcDataARYW[peerIndex];
+      position = count;
+      while ( (position > 0) && (peerARYW[position - 1] > dataW)) {
+        peerARYW[position] = peerARYW[position - 1];
+        position--;
+      }
+      peerARYW[position] = dataW;
+      count++;
+    }
+  }
+
+  return peerARYW[count / 2];
+}
+
+
+/*
+================================================================================
+Method name:  ADCReadPlausibility
+                    
+Originator:   
+
+Description: 
+  The purpose of this function is to check the filtered data of the chamber
+  thermistor against the last accepted data and its peers. A change larger
+  than ADC_PLAUSIBLE_SLEW per second (plus ADC_PLAUSIBLE_NOISE) is implausible
+  unless the data is within ADC_PLAUSIBLE_PEER_BAND of the peer median. The
+  implausible data is replaced by the last accepted data and counted as
+  suppressed, till ADC_PLAUSIBLE_CONFIRM samples in a row confirm it.
+
+  This method should be called using ADCReadPlausibility().
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+static void ADCReadPlausibility(uint8_t channelIndex)
+{
+  uint8_t chamber = channelIndex - CHAMBER_TEMPERATURE1;
+  uint16_t dataW = adcRead.adcDataARYW[channelIndex];
+  uint16_t acceptedW = adcRead.plausibleDataARYW[chamber];
+  uint16_t tickW = scheduler.tickCountW;
+  uint16_t elapsedW;
+  uint16_t limitW;
+  uint16_t peerW;
+  bool plausibleFLG = true;
+
+  // First data after the detection is accepted
+  if ( acceptedW != 0) {
+    elapsedW = tickW - adcRead.plausibleTickARYW[chamber];
+    limitW = ADC_PLAUSIBLE_NOISE +                                      \
+            (uint16_t) (((uint32_t) ADC_PLAUSIBLE_SLEW * elapsedW) / 1000);
+
+    if ( ((dataW > acceptedW) && ((dataW - acceptedW) > limitW)) ||     \
+            ((dataW < acceptedW) && ((acceptedW - dataW) > limitW))) {
+      // Fast change is plausible if the peers read the same
+      peerW = ADCReadPeerMedian(channelIndex);
+      if ( ((dataW > peerW) && ((dataW - peerW) > ADC_PLAUSIBLE_PEER_BAND)) || \
+              ((dataW < peerW) && ((peerW - dataW) > ADC_PLAUSIBLE_PEER_BAND))) {
+        plausibleFLG = false;
+      }
+    }
+  }
+
+  if ( (plausibleFLG == false) &&                                       \
+          (++adcRead.plausiblePendingARY[chamber] < ADC_PLAUSIBLE_CONFIRM)) {
+    // Hold the last accepted data till the change is confirmed
+    adcRead.adcDataARYW[channelIndex] = acceptedW;
+    if ( adcRead.suppressedCountARYW[chamber] < UINT16_MAX) {
+      adcRead.suppressedCountARYW[chamber]++;
+    }
+  }
+  else {
+    adcRead.plausiblePendingARY[chamber] = 0;
+    adcRead.plausibleDataARYW[chamber] = dataW;
+    adcRead.plausibleTickARYW[chamber] = tickW;
+  }
+}
+#endif
+
+
+/*
+================================================================================
+Method name:  ADCReadProbeOpen
+                    
+Originator:   
+
+Description: 
+  The purpose of this function is to return true if the last probe of the
+  thermistor pin read it high, which means the analog pin is open.
+
+  This is an inline function and this method should be called using
+  ADCReadProbeOpen().
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+static inline bool ADCReadProbeOpen(uint8_t channelIndex)
+{
+  return ((adcRead.probeValidMask & adcRead.probeOpenMask &             \
+          (uint8_t) (1 << channelIndex)) != 0);
+}
+
+
+/*
+================================================================================
+Method name:  checkThermistorError
+                    
+Originator:   Poorana kumar G
+
+Description: 
+  The purpose of this function is to detect the open & short errors of the
+  thermistors based on the ADC output.
+
+  This method should be called using checkThermistorError().
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+       05-12-2020  Initial Write                        Poorana kumar G
+2.6.0  10-16-2026  GPIO status is taken from the cached
+                   probe result, the errors are kept till
+                   the first probe of the pin.
+2.6.0  10-16-2026  Thresholds and errors are taken from the
+                   channel descriptor.
+--------------------------------------------------------------------------------
+*/
+
+static void checkThermistorError(uint8_t thermistorNum)
+{
+  if ( thermistorNum <= CHAMBER_TEMPERATURE4) {
+    const ADCChannel_STYP *channelPTR = &adcChannelARY[thermistorNum];
+    uint16_t adcCount = adcRead.adcDataARYW[thermistorNum];
+    uint8_t probeBit = (uint8_t) (1 << thermistorNum);
+    bool ioStatus = 0;
+    bool probedFLG = true;
+
+    // Thermistor ADC count error check
+    if ( adcCount < channelPTR->lowCountW) {
+      // Declare thermistor open error
+      faultIndication.Error(channelPTR->lowError);
+      adcRead.probeValidMask &= (uint8_t) ~probeBit;
+    }
+    else if(adcCount > THERMISTOR_ANALOG_PIN_OPEN_THRESHOLD) {
+      // Request the GPIO status, it is probed once per probe interval
+      adcRead.probeRequestMask |= probeBit;
+
+      if ( (adcRead.probeValidMask & probeBit) == 0) {
+        // Keep the errors till the GPIO status is probed
+        probedFLG = false;
+      }
+      else if ( (adcRead.probeOpenMask & probeBit) != 0) {
+        // Declare thermistor open error
+        ioStatus = true;
+        faultIndication.Error(channelPTR->lowError);
+      }
+      else {
+        // Clear thermistor open error
+        faultIndication.Clear(channelPTR->lowError);
+      }
+    }
+    else {
+      // Clear thermistor open error
+      faultIndication.Clear(channelPTR->lowError);
+      adcRead.probeValidMask &= (uint8_t) ~probeBit;
+    }
+
+    if ( probedFLG == true) {
+      if ( (adcCount > channelPTR->highCountW) && (ioStatus == false)) {
+        // If really short, declare thermistor short error
+        faultIndication.Error(channelPTR->highError);
+      }
+      else {
+        // Clear short error
+        faultIndication.Clear(channelPTR->highError);
+      }
+    }
+  }
+}
+
+
+/*
+================================================================================
+Method name:  checkVccError
+                    
+Originator:   Poorana kumar G
+
+Description: 
+  The purpose of this function is to detect the error in the DC supply of the
+  controller based on the ADC output.
+
+  This method should be called using checkVccError().
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+       05-12-2020  Initial Write                        Poorana kumar G
+2.6.0  10-16-2026  Tolerance band is taken from the channel
+                   descriptor.
+--------------------------------------------------------------------------------
+*/
+
+static void checkVccError(void)
+{
+  uint16_t PowerADCLocalW = 0;
+
+  // Check power supply error
+  if ( adcRead.adcDataARYW[VCC_VOLTAGE] > adcChannelARY[VCC_VOLTAGE].highCountW) {
+    // Declare power supply error
+    faultIndication.Error(DC_SUPPLY_ERROR);
+  }
+  else {
+    if ( adcRead.adcDataARYW[VCC_VOLTAGE] < adcChannelARY[VCC_VOLTAGE].lowCountW) {
+      // Declare power supply error
+      faultIndication.Error(DC_SUPPLY_ERROR);
+    }
+    else {
+      PowerADCLocalW = ((uint32_t) adcRead.adcDataARYW[VCC_VOLTAGE] * 2 * \
+              ADC_REF_VOLTAGE) / ADC_FULL_COUNT;
+
+      if ( PowerADCLocalW < POWER_SUPPLY_MIN_VOLTAGE) {
+        // Declare power supply error
+        faultIndication.Error(DC_SUPPLY_ERROR);
+      }
+      else {
+        faultIndication.Clear(DC_SUPPLY_ERROR);
+      }
+    }
+  }
+}
+
+
+/*
+================================================================================
+Method name:  ADCReadThermistorFitted
+                    
+Originator:   
+
+Description: 
+  The purpose of this function is to return true if a thermistor is fitted on
+  the channel. The count between the open and short counts is a fitted
+  thermistor. Above the short count, the thermistor is taken as fitted (and
+  shorted) only if probeFLG is true and the probed pin is not open.
+
+  This method should be called using ADCReadThermistorFitted().
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+static bool ADCReadThermistorFitted(uint8_t channelIndex, bool probeFLG)
+{
+  uint16_t adcCount = adcRead.adcDataARYW[channelIndex];
+  bool fittedFLG = false;
+
+  // Check that ADC count is in range
+  if ( (adcCount < adcChannelARY[channelIndex].highCountW) &&           \
+          (adcCount > adcChannelARY[channelIndex].lowCountW)) {
+    fittedFLG = true;
+  }
+  else if ( (adcCount >= adcChannelARY[channelIndex].highCountW) &&     \
+          (probeFLG == true)) {
+    // If IO is high means analog pin is open. Enable to declare thermistor error
+    fittedFLG = !ADCReadProbeOpen(channelIndex);
+  }
+  else {
+    // Nothing To Do
+  }
+
+  return fittedFLG;
+}
+
+
+/*
+================================================================================
+Method name:  ADCReadCountThermistors
+                    
+Originator:   
+
+Description: 
+  The purpose of this function is to count the detected chamber thermistors,
+  leaving out the one taken only to show the error, and to update the valid
+  thermistors flag.
+
+  This method should be called using ADCReadCountThermistors().
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+static void ADCReadCountThermistors(void)
+{
+  uint8_t fittedMask = adcRead.detectedMask & (uint8_t) ~adcRead.forcedMask;
+
+  // Reset the counter for measuring the connected themistors
+  adcRead.connectThermistor = 0;
+  while ( fittedMask != 0) {
+    // Clear the lowest set bit
+    fittedMask &= (uint8_t) (fittedMask - 1);
+    adcRead.connectThermistor++;
+  }
+
+  if ( adcRead.connectThermistor >= MINIMUM_THERMISOR_COUNTS) {
+    adcRead.flags.validThermistorsFLG = true;
+  }
+  else {
+    adcRead.flags.validThermistorsFLG = false;
+  }
+}
+
+
+/*
+================================================================================
+Method name:  chamberThermistorDectection
+                    
+Originator:   Poorana kumar G
+
+Description: 
+  The purpose of this function is used to detect the inserted chamber thermistors
+  during power up .
+
+  This method should be called using adcRead.DetectThermistor().
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+       02-04-2019  Initial Write                        Poorana kumar G
+2.6.0  10-16-2026  GPIO status is taken from the probe
+                   run during the detection time.
+2.6.0  10-16-2026  Chamber thermistors are taken from the
+                   channel descriptor table.
+--------------------------------------------------------------------------------
+*/
+
+void chamberThermistorDectection(void)
+{
+  uint8_t channelIndex;
+
+  adcRead.detectedMask = 0;
+  adcRead.forcedMask = 0;
+
+  for ( channelIndex = 0; channelIndex < TOTAL_ADC_CHANNELS; channelIndex++) {
+    if ( (adcChannelARY[channelIndex].role == ADC_ROLE_CHAMBER_THERMISTOR) && \
+            (ADCReadThermistorFitted(channelIndex, true) == true)) {
+      adcRead.detectedMask |= ADC_CHANNEL_BIT(channelIndex);
+    }
+  }
+
+  // If no thermistors are detected consider chamber thermistor 1 detected
+  // to indicate the error code on 7 segment display.
+  if ( adcRead.detectedMask == 0) {
+    adcRead.forcedMask = ADC_CHANNEL_BIT(CHAMBER_TEMPERATURE1);
+    adcRead.detectedMask = adcRead.forcedMask;
+  }
+
+  ADCReadCountThermistors();
+}
+
+
+/*
+================================================================================
+Method name:  ADCReadRedetect
+                    
+Originator:   
+
+Description: 
+  The purpose of this function is to detect a chamber thermistor fitted after
+  the power ON detection, e.g. reseated after service. Once per
+  ADC_REDETECT_INTERVAL_SCANS the undetected chamber thermistors are checked,
+  and a thermistor in range for ADC_REDETECT_CONFIRM checks in a row is
+  detected. Its sample history and plausibility start again from its own data.
+  A detected thermistor is not dropped, its open error is shown instead.
+
+  This method should be called using ADCReadRedetect().
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+static void ADCReadRedetect(void)
+{
+  uint8_t channelIndex;
+  uint8_t chamber;
+  uint8_t channelBit;
+
+  if ( adcRead.redetectTimer != 0) {
+    adcRead.redetectTimer--;
+    return;
+  }
+  adcRead.redetectTimer = ADC_REDETECT_INTERVAL_SCANS;
+
+  for ( channelIndex = 0; channelIndex < TOTAL_ADC_CHANNELS; channelIndex++) {
+    channelBit = ADC_CHANNEL_BIT(channelIndex);
+
+    if ( (adcChannelARY[channelIndex].role != ADC_ROLE_CHAMBER_THERMISTOR) || \
+            ((adcRead.detectedMask & ~adcRead.forcedMask & channelBit) != 0)) {
+      continue;
+    }
+
+    chamber = channelIndex - CHAMBER_TEMPERATURE1;
+    if ( ADCReadThermistorFitted(channelIndex, false) == false) {
+      adcRead.redetectCountARY[chamber] = 0;
+    }
+    else if ( ++adcRead.redetectCountARY[chamber] >= ADC_REDETECT_CONFIRM) {
+      adcRead.redetectCountARY[chamber] = 0;
+
+      // Chamber thermistor 1 taken only to show the error is released
+      if ( adcRead.forcedMask != 0) {
+        adcRead.detectedMask &= (uint8_t) ~adcRead.forcedMask;
+        adcRead.forcedMask = 0;
+        faultIndication.Clear(adcChannelARY[CHAMBER_TEMPERATURE1].lowError);
+        faultIndication.Clear(adcChannelARY[CHAMBER_TEMPERATURE1].highError);
+      }
+
+      adcRead.detectedMask |= channelBit;
+      adcRead.historyCountARY[channelIndex] = 0;
+#ifdef ADCREAD_PLAUSIBILITY
+      adcRead.plausibleDataARYW[chamber] = 0;
+      adcRead.plausiblePendingARY[chamber] = 0;
+#endif
+      ADCReadCountThermistors();
+    }
+  }
+}
+
+
+#ifdef ADCREAD_SELF_CALIBRATION
+/*
+================================================================================
+Method name:  ADCReadCalibrated
+                    
+Originator:   
+
+Description: 
+  The purpose of this function is to return the raw ADC count corrected by the
+  self calibration offset and gain. The raw count has shifts extra bits of the
+  oversampling.
+
+  This is an inline function and this method should be called using
+  ADCReadCalibrated().
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+2.6.0  10-16-2026  Oversampled counts are corrected.
+--------------------------------------------------------------------------------
+*/
+
+static inline uint16_t ADCReadCalibrated(uint16_t rawDataW, uint8_t shifts)
+{
+  int32_t correctedL;
+
+  correctedL = (((int32_t) rawDataW - ((int32_t) adcRead.adcOffsetW << shifts)) * \
+          ((1 << ADC_CALIBRATION_SHIFT) + adcRead.adcGainTrimW)) >>     \
+          ADC_CALIBRATION_SHIFT;
+  if ( correctedL < 0) {
+    correctedL = 0;
+  }
+  else if ( correctedL >= ((int32_t) ADC_FULL_COUNT << shifts)) {
+    correctedL = ((int32_t) ADC_FULL_COUNT << shifts) - 1;
+  }
+
+  return (uint16_t) correctedL;
+}
+
+
+/*
+================================================================================
+Method name:  ADCReadCalibrate
+                    
+Originator:   
+
+Description: 
+  The purpose of this function is to run the offset & gain self calibration,
+  once per scan. The zero reading of the discharged CTMU conversion and the
+  raw VCC/2 readings are summed over ADC_CALIBRATION_PERIOD_SCANS scans. At
+  the end of each pass the offset is the mean zero reading, and the gain trim
+  maps the mean VCC/2 reading less the offset to POWER_SUPPLY_ADC_COUNT, both
+  within their limits.
 
-Resources:
-  8 ADC channel inputs
+  The VCC/2 channel is the 5V supply, which is also the ADC reference, through
+  a divide by 2 divider. So it is at the middle of the scale at any supply
+  voltage and its error is the gain error of the ADC and the divider. The gain
+  is kept when the VCC/2 reading is out of the supply tolerance, the DC supply
+  error is reported then.
 
-IoTranslate requirements:
-  The following #defines are used in ADC read operation.
+  The discharged channel reads 0 for a negative offset, so the offset is only
+  measured down to 0 and the gain trim takes up a negative offset at the
+  middle of the scale.
 
-  #define ADCREAD_CHANNEL_SELECT(ChannelIndex)
-  #define ADCREAD_START_SAMPLING()
-  #define ADCREAD_CONVERSION_COMPLETE()
-  #define ADCREAD_READ_REGISTER()
+  The calibration is written to the flash when it is ADC_CALIBRATION_STORE_DELTA
+  away from the stored one, so the page is not erased for the noise of every
+  pass.
 
-  The following functions are used in ADC read operation.
-  ADCReadTriggerDischarge()
-  ADCReadStopDischarge()
-  readADCIOStatus()
-  
+  This method should be called using ADCReadCalibrate().
+
+Resources:
+  None
 ================================================================================
  History:	
 -*-----*-----------*------------------------------------*-----------------------
-       09-24-2019  Initial Write                            Poorana kumar G
-       11-04-2019  PC-Lint warning is cleared by adding     Poorana kumar G
-                   "static" in "LowPassFilter" function.
-1.1.0  02-04-2020  As per the Beta requirement changes      Poorana kumar G
-                   updated the functions
-2.2.0  07-16-2020  Macro to disable the inlet temperature   Poorana kumar G
-                   ADC conversion is added.
-2.3.0  09-15-2020  Averaging is made common for all the     Poorana kumar G
-                   analog channels 
+2.6.0  10-16-2026  Initial Write
 --------------------------------------------------------------------------------
 */
 
-#include "ADCRead.h"
+static void ADCReadCalibrate(void)
+{
+  int16_t offsetW;
+  int16_t deltaW;
+  int32_t gainL;
+  bool storeFLG = false;
+
+  adcRead.zeroSumL += adcRead.zeroDataW;
+  if ( ++adcRead.calibrationScansW < ADC_CALIBRATION_PERIOD_SCANS) {
+    return;
+  }
 
-// List of channels to be converted
-static const ADC1_CHANNEL ADCReadChannels[] =
-{
-  ADC1_INLET_TEMPERATURE_ADC, 
-  ADC1_OUTLET_TEMPERATURE_ADC,
-  ADC1_CHAMBER_TEMPERATURE1,
-  ADC1_CHAMBER_TEMPERATURE2,
-  ADC1_CHAMBER_TEMPERATURE3,
-  ADC1_CHAMBER_TEMPERATURE4,
-  ADC1_MOISTURE_DETECT_ADC,   
-  ADC1_VCC_VOLTAGE_ADC,       
-};
+  offsetW = (int16_t) (adcRead.zeroSumL / ADC_CALIBRATION_PERIOD_SCANS);
+  adcRead.zeroSumL = 0;
+  adcRead.calibrationScansW = 0;
 
-// Thermistor open errors list
-static const Errors_ETYP thermOpenErrors[] =
-{
-  THERMISTOR1_OPEN_ERROR,
-  THERMISTOR2_OPEN_ERROR,
-  THERMISTOR3_OPEN_ERROR,
-  THERMISTOR4_OPEN_ERROR,
-  THERMISTOR5_OPEN_ERROR,
-  THERMISTOR6_OPEN_ERROR
-};
+  if ( offsetW > ADC_CALIBRATION_MAX_OFFSET) {
+    offsetW = ADC_CALIBRATION_MAX_OFFSET;
+  }
+  else if ( offsetW < -ADC_CALIBRATION_MAX_OFFSET) {
+    offsetW = -ADC_CALIBRATION_MAX_OFFSET;
+  }
+  adcRead.adcOffsetW = offsetW;
+
+  // Gain trim from the mean VCC/2 reading, kept out of the supply tolerance
+  if ( adcRead.vccSamplesW != 0) {
+    gainL = (int32_t) (adcRead.vccSumL / adcRead.vccSamplesW);
+
+    if ( (gainL >= adcChannelARY[VCC_VOLTAGE].lowCountW) &&              \
+            (gainL <= adcChannelARY[VCC_VOLTAGE].highCountW)) {
+      gainL = (((int32_t) POWER_SUPPLY_ADC_COUNT << ADC_CALIBRATION_SHIFT) + \
+              ((gainL - offsetW) / 2)) / (gainL - offsetW);
+      gainL -= (1 << ADC_CALIBRATION_SHIFT);
+      if ( gainL > ADC_CALIBRATION_MAX_TRIM) {
+        gainL = ADC_CALIBRATION_MAX_TRIM;
+      }
+      else if ( gainL < -ADC_CALIBRATION_MAX_TRIM) {
+        gainL = -ADC_CALIBRATION_MAX_TRIM;
+      }
+      adcRead.adcGainTrimW = (int16_t) gainL;
+    }
+  }
+  adcRead.vccSumL = 0;
+  adcRead.vccSamplesW = 0;
+
+  // Store the calibration when it has moved from the stored one
+  deltaW = adcRead.adcOffsetW - nonVol.settings.adcOffset;
+  if ( (deltaW >= ADC_CALIBRATION_STORE_DELTA) ||                       \
+          (deltaW <= -ADC_CALIBRATION_STORE_DELTA)) {
+    storeFLG = true;
+  }
+  deltaW = adcRead.adcGainTrimW - nonVol.settings.adcGainTrim;
+  if ( (deltaW >= ADC_CALIBRATION_STORE_DELTA) ||                       \
+          (deltaW <= -ADC_CALIBRATION_STORE_DELTA)) {
+    storeFLG = true;
+  }
 
-// Thermistor short errors list
-static const Errors_ETYP thermShortErrors[] =
-{
-  THERMISTOR1_SHORT_ERROR,
-  THERMISTOR2_SHORT_ERROR,
-  THERMISTOR3_SHORT_ERROR,
-  THERMISTOR4_SHORT_ERROR,
-  THERMISTOR5_SHORT_ERROR,
-  THERMISTOR6_SHORT_ERROR,
-};
+  if ( storeFLG == true) {
+    nonVol.settings.adcOffset = (int8_t) adcRead.adcOffsetW;
+    nonVol.settings.adcGainTrim = (int8_t) adcRead.adcGainTrimW;
+    nonVol.write();
+  }
+}
+#endif
 
 
 /*
 ================================================================================
-Method name:  LowPassFilter
+Method name:  ADCReadLoadCalibration
                     
-Originator:   Poorana kumar G
+Originator:   
 
 Description: 
-  The purpose of this function is used to do the low pass filter operation on
-  ADC's output.
+  The purpose of this function is to load the offset & gain trim stored with
+  the settings, so the first scans are corrected too. The stored values out of
+  their limits are not used.
 
-  This is an inline function and this method should be called using
-  LowPassFilter().
+  This method should be called using adcRead.LoadCalibration() after the
+  settings are read.
 
 Resources:
   None
 ================================================================================
  History:	
 -*-----*-----------*------------------------------------*-----------------------
-       10-14-2019  Initial Write                        Poorana kumar G
-       11-04-2019  PC-Lint warning is cleared by        Poorana kumar G
-                   adding "static".
+2.6.0  10-16-2026  Initial Write
 --------------------------------------------------------------------------------
 */
 
-static inline uint16_t LowPassFilter(uint16_t *filterRegPTRW, uint16_t rawDataW)
+void ADCReadLoadCalibration(void)
 {
-  if ( *filterRegPTRW != 0) {
-    // Allow the 1/4 of the change in ADC count.
-    (*filterRegPTRW) -= (*filterRegPTRW >> ADC_FILTER_SHIFTS);
-    (*filterRegPTRW) += rawDataW;
+#ifdef ADCREAD_SELF_CALIBRATION
+  if ( (nonVol.settings.adcOffset <= ADC_CALIBRATION_MAX_OFFSET) &&      \
+          (nonVol.settings.adcOffset >= -ADC_CALIBRATION_MAX_OFFSET)) {
+    adcRead.adcOffsetW = nonVol.settings.adcOffset;
   }
-  else {
-    // Initialize the filter register.
-    (*filterRegPTRW) = (rawDataW << ADC_FILTER_SHIFTS);
+  if ( (nonVol.settings.adcGainTrim <= ADC_CALIBRATION_MAX_TRIM) &&      \
+          (nonVol.settings.adcGainTrim >= -ADC_CALIBRATION_MAX_TRIM)) {
+    adcRead.adcGainTrimW = nonVol.settings.adcGainTrim;
   }
-
-  return ((*filterRegPTRW) >> ADC_FILTER_SHIFTS);
+#endif
 }
 
 
 /*
 ================================================================================
-Method name:  checkThermistorError
+Method name:  ADCReadProcess
                     
 Originator:   Poorana kumar G
 
 Description: 
-  The purpose of this function is to detect the open & short errors of the
-  thermistors based on the ADC output.
+  The purpose of this function is to filter the converted data of the channel
+  and to check it for the errors once the power ON thermistor detection is
+  completed.
 
-  This method should be called using checkThermistorError().
+  This method should be called using ADCReadProcess().
 
 Resources:
   None
 ================================================================================
  History:	
 -*-----*-----------*------------------------------------*-----------------------
-       05-12-2020  Initial Write                        Poorana kumar G
+       09-24-2019  Initial Write                        Poorana kumar G
+2.6.0  10-16-2026  Moved out of ADCRead() to process the
+                   DMA scan buffer too.
+2.6.0  10-16-2026  Filtered by the filter bank.
+2.6.0  10-16-2026  Samples of the probed pins are discarded.
+2.6.0  10-16-2026  Thermistor samples are recorded in the
+                   sample history.
+2.6.0  10-16-2026  Chamber thermistor data is checked for
+                   plausibility.
+2.6.0  10-16-2026  Checks are selected by the channel role.
+2.6.0  10-16-2026  Raw count is corrected by the self
+                   calibration.
+2.6.0  10-16-2026  Thermistor raw count has the extra bits
+                   of the oversampling.
+2.6.0  10-16-2026  Thermistor data is compensated for the
+                   thermal lag.
 --------------------------------------------------------------------------------
 */
 
-static void checkThermistorError(uint8_t thermistorNum)
+static void ADCReadProcess(uint8_t channelIndex, uint16_t rawDataW)
 {
-  if ( thermistorNum <= CHAMBER_TEMPERATURE4) {
-    uint16_t adcCount = adcRead.adcDataARYW[thermistorNum];
-    bool ioStatus = 0;
+  const ADCChannel_STYP *channelPTR = &adcChannelARY[channelIndex];
+  bool thermistorFLG = (channelPTR->role == ADC_ROLE_PIPE_THERMISTOR) || \
+          (channelPTR->role == ADC_ROLE_CHAMBER_THERMISTOR);
+  uint16_t fineW;
+
+  // Pin is a GPIO for the probe, the sample is not the thermistor voltage
+  if ( (adcRead.probeMask & (uint8_t) (1 << channelIndex)) != 0) {
+    return;
+  }
 
-    // Thermistor ADC count error check
-    if ( adcCount < THERMISTOR_OPEN_ADC_COUNT) {
-      // Declare thermistor open error
-      faultIndication.Error(thermOpenErrors[thermistorNum]);
-    }
-    else if(adcCount > THERMISTOR_ANALOG_PIN_OPEN_THRESHOLD) {
-      // Read the GPIO status
-      ioStatus = readADCIOStatus(thermistorNum);
+#ifdef ADCREAD_SELF_CALIBRATION
+  if ( channelPTR->role == ADC_ROLE_SUPPLY) {
+    // Raw VCC/2 reading for the gain trim
+    adcRead.vccSumL += rawDataW;
+    adcRead.vccSamplesW++;
+  }
+  rawDataW = ADCReadCalibrated(rawDataW,                                \
+          (thermistorFLG == true) ? ADC_OVERSAMPLE_BITS : 0);
+#endif
 
-      if ( ioStatus == true) {
-        // Declare thermistor open error
-        faultIndication.Error(thermOpenErrors[thermistorNum]);
-      }
-      else {
-        // Clear thermistor open error
-        faultIndication.Clear(thermOpenErrors[thermistorNum]);
+  adcRead.adcDataARYW[channelIndex] = ADCReadFilter(channelIndex, rawDataW);
+
+  // Double temperatures so when we average we do not lose resolution
+  // After averaged that it is converted to the format of actual one used.
+  if ( thermistorFLG == true) {
+    // Oversampled count has ADC_OVERSAMPLE_BITS below the ADC count
+    fineW = (uint16_t) (((((uint32_t) ADC_FULL_COUNT << ADC_OVERSAMPLE_BITS) - \
+            adcRead.adcDataARYW[channelIndex]) * 2) >>                  \
+            (ADC_OVERSAMPLE_BITS - ADC_FINE_SHIFT));
+    adcRead.adcDataARYW[channelIndex] = fineW >> ADC_FINE_SHIFT;
+
+#ifdef ADCREAD_PLAUSIBILITY
+    // Detected chamber thermistors after the power ON detection
+    if ( (channelPTR->role == ADC_ROLE_CHAMBER_THERMISTOR) &&           \
+            (adcRead.powerONADCDetTimer == 0) &&                        \
+            ADCREAD_DETECTED(channelIndex)) {
+      ADCReadPlausibility(channelIndex);
+
+      // Held data has no bits below the half unit
+      if ( (fineW >> ADC_FINE_SHIFT) != adcRead.adcDataARYW[channelIndex]) {
+        fineW = adcRead.adcDataARYW[channelIndex] << ADC_FINE_SHIFT;
       }
     }
-    else {
-      // Clear thermistor open error
-      faultIndication.Clear(thermOpenErrors[thermistorNum]);
-    }
+#endif
 
-    if ( (adcCount > THERMISTOR_SHORT_ADC_COUNT) && (ioStatus == false)) {
-      // If really short, declare thermistor short error
-      faultIndication.Error(thermShortErrors[thermistorNum]);
+#ifdef ADCREAD_LAG_COMPENSATION
+    if ( ADCReadRecord(channelIndex, fineW) == true) {
+      // Lead follows the slope, which changes only with a new entry
+      adcRead.leadARYW[channelIndex] = ADCReadLead(channelIndex);
     }
-    else {
-      // Clear short error
-      faultIndication.Clear(thermShortErrors[thermistorNum]);
+    adcRead.compensatedARYW[channelIndex] = ADCReadCompensated(channelIndex);
+#else
+    (void) ADCReadRecord(channelIndex, fineW);
+    adcRead.compensatedARYW[channelIndex] = adcRead.adcDataARYW[channelIndex];
+#endif
+  }
+
+  // After power ON thermistor detection completed
+  if ( adcRead.powerONADCDetTimer == 0 ) {
+    switch ( channelPTR->role) {
+      // Inlet & Outlet thermistor ADC count error check
+      case ADC_ROLE_PIPE_THERMISTOR:
+        checkThermistorError(channelIndex);
+        break;
+
+      case ADC_ROLE_CHAMBER_THERMISTOR:
+        // If Chamber thermistor is detected
+        if ( ADCREAD_DETECTED(channelIndex)) {
+          checkThermistorError(channelIndex);
+        }
+        break;
+
+      case ADC_ROLE_MOISTURE:
+        // Moisture detector ADC count error check
+        // Clearing leak detection error only by power reset
+        if ( (adcRead.adcDataARYW[channelIndex] < channelPTR->lowCountW) || \
+                (adcRead.adcDataARYW[channelIndex] > channelPTR->highCountW)) {
+          // Declare leak detection error
+          faultIndication.Error(channelPTR->lowError);
+        }
+        break;
+
+      case ADC_ROLE_SUPPLY:
+        // DC Supply voltage monitor
+        checkVccError();
+        break;
+        
+      default:
+        break;
     }
   }
 }
@@ -195,168 +1584,319 @@ static void checkThermistorError(uint8_t thermistorNum)
 
 /*
 ================================================================================
-Method name:  checkVccError
+Method name:  ADCReadProbe
                     
-Originator:   Poorana kumar G
+Originator:   
 
 Description: 
-  The purpose of this function is to detect the error in the DC supply of the
-  controller based on the ADC output.
+  The purpose of this function is to probe the requested thermistor pins over
+  the scans, without waiting for the IO level. The pins are configured as GPIO
+  with pull up at the end of one scan and read back at the end of the next
+  scan, one more scan is discarded while they settle as analog inputs. The
+  results are cached per pin and the pins are probed again after
+  ADC_PROBE_INTERVAL_SCANS.
 
-  This method should be called using checkVccError().
+  This method should be called using ADCReadProbe().
 
 Resources:
-  None
+  ADCReadProbeStart() and ADCReadProbeEnd() from IoTranslate
 ================================================================================
  History:	
 -*-----*-----------*------------------------------------*-----------------------
-       05-12-2020  Initial Write                        Poorana kumar G
+2.6.0  10-16-2026  Initial Write
 --------------------------------------------------------------------------------
 */
 
-static void checkVccError(void)
+static void ADCReadProbe(void)
 {
-  uint16_t PowerADCLocalW = 0;
-
-  // Check power supply error
-  PowerADCLocalW = POWER_SUPPLY_ADC_COUNT +                             \
-          ((POWER_SUPPLY_ADC_COUNT * POWER_SUPPLY_TOLERANCE) / 100);
-        
-  if ( adcRead.adcDataARYW[VCC_VOLTAGE] > PowerADCLocalW) {
-    // Declare power supply error
-    faultIndication.Error(DC_SUPPLY_ERROR);
-  }
-  else {
-    PowerADCLocalW = POWER_SUPPLY_ADC_COUNT -                             \
-            ((POWER_SUPPLY_ADC_COUNT * POWER_SUPPLY_TOLERANCE) / 100);
+  uint8_t channelIndex;
+  uint8_t probeBit;
 
-    if ( adcRead.adcDataARYW[VCC_VOLTAGE] < PowerADCLocalW) {
-      // Declare power supply error
-      faultIndication.Error(DC_SUPPLY_ERROR);
-    }
-    else {
-      PowerADCLocalW = ((uint32_t) adcRead.adcDataARYW[VCC_VOLTAGE] * 2 * \
-              ADC_REF_VOLTAGE) / ADC_FULL_COUNT;
+  switch ( adcRead.probeState) {
+    case ADC_PROBE_IDLE:
+      if ( adcRead.probeTimer != 0) {
+        adcRead.probeTimer--;
+      }
+      else if ( adcRead.probeRequestMask != 0) {
+        adcRead.probeMask = adcRead.probeRequestMask;
+        adcRead.probeRequestMask = 0;
 
-      if ( PowerADCLocalW < POWER_SUPPLY_MIN_VOLTAGE) {
-        // Declare power supply error
-        faultIndication.Error(DC_SUPPLY_ERROR);
+        for ( channelIndex = 0; channelIndex <= CHAMBER_TEMPERATURE4; channelIndex++) {
+          if ( (adcRead.probeMask & (uint8_t) (1 << channelIndex)) != 0) {
+            ADCReadProbeStart(channelIndex);
+          }
+        }
+        adcRead.probeState = ADC_PROBE_SETTLING;
       }
-      else {
-        faultIndication.Clear(DC_SUPPLY_ERROR);
+      break;
+
+    case ADC_PROBE_SETTLING:
+      // IO level is settled over one scan
+      for ( channelIndex = 0; channelIndex <= CHAMBER_TEMPERATURE4; channelIndex++) {
+        probeBit = (uint8_t) (1 << channelIndex);
+
+        if ( (adcRead.probeMask & probeBit) != 0) {
+          if ( ADCReadProbeEnd(channelIndex) == true) {
+            adcRead.probeOpenMask |= probeBit;
+          }
+          else {
+            adcRead.probeOpenMask &= (uint8_t) ~probeBit;
+          }
+          adcRead.probeValidMask |= probeBit;
+        }
       }
-    }
+      adcRead.probeState = ADC_PROBE_RESTORING;
+      break;
+
+    case ADC_PROBE_RESTORING:
+    default:
+      // Samples of the probed pins are used from the next scan
+      adcRead.probeMask = 0;
+      adcRead.probeTimer = ADC_PROBE_INTERVAL_SCANS;
+      adcRead.probeState = ADC_PROBE_IDLE;
+      break;
   }
 }
 
 
 /*
 ================================================================================
-Method name:  chamberThermistorDectection
+Method name:  ADCReadScanEnd
                     
 Originator:   Poorana kumar G
 
 Description: 
-  The purpose of this function is used to detect the inserted chamber thermistors
-  during power up .
+  The purpose of this function is to detect the chamber thermistors once the
+  power ON detection time is over, and to signal the scan complete event to the
+  scheduler after all the channels are converted.
 
-  This method should be called using adcRead.DetectThermistor().
+  This method should be called using ADCReadScanEnd().
 
 Resources:
-  readADCIOStatus() from IoTranslate
+  None
 ================================================================================
  History:	
 -*-----*-----------*------------------------------------*-----------------------
-       02-04-2019  Initial Write                        Poorana kumar G
+       09-24-2019  Initial Write                        Poorana kumar G
+2.6.0  10-16-2026  Moved out of ADCRead() to end the DMA
+                   scan too.
+2.6.0  10-16-2026  Thermistor pin probe is run.
+2.6.0  10-16-2026  Chamber thermistors are re-detected
+                   after the power ON detection.
+2.6.0  10-16-2026  Self calibration is run.
+2.6.0  10-16-2026  Scan complete event is signalled on
+                   every scan.
 --------------------------------------------------------------------------------
 */
 
-void chamberThermistorDectection(void)
+static void ADCReadScanEnd(void)
 {
-//    Reset the counter for measuring the connected themistors
-    adcRead.connectThermistor = 0;
-    // Check that chamber temperature 1 ADC count is in range
-  if ( (adcRead.adcDataARYW[CHAMBER_TEMPERATURE1] < THERMISTOR_SHORT_ADC_COUNT) && \
-          (adcRead.adcDataARYW[CHAMBER_TEMPERATURE1] > THERMISTOR_OPEN_ADC_COUNT)) {
-    adcRead.flags.thermistor1DetectedFLG = true;
-    adcRead.connectThermistor++;
-  }
-  else if (adcRead.adcDataARYW[CHAMBER_TEMPERATURE1] >= THERMISTOR_SHORT_ADC_COUNT) {
-    if ( readADCIOStatus(CHAMBER_TEMPERATURE1) == false) {
-      // If IO is high means analog pin is open. Enable to declare thermistor error
-      adcRead.flags.thermistor1DetectedFLG = true;
-      adcRead.connectThermistor++;
+#ifdef ADCREAD_SELF_CALIBRATION
+  ADCReadCalibrate();
+#endif
+
+  ADCReadProbe();
+
+  // Wait for timer to become 0 to detect the chamber thermistors
+  if ( adcRead.powerONADCDetTimer != 0 ) {
+    // Probe the chamber thermistor pins before the detection
+    adcRead.probeRequestMask |= ADC_PROBE_CHAMBER_MASK;
+    adcRead.powerONADCDetTimer--;
+
+    if ( adcRead.powerONADCDetTimer == 0 ) {
+      adcRead.DetectThermistor();
     }
   }
   else {
-    // Nothing To Do
+    ADCReadRedetect();
   }
 
-  // Check that chamber temperature 2 ADC count is in range
-  if ( (adcRead.adcDataARYW[CHAMBER_TEMPERATURE2] < THERMISTOR_SHORT_ADC_COUNT) && \
-          (adcRead.adcDataARYW[CHAMBER_TEMPERATURE2] > THERMISTOR_OPEN_ADC_COUNT)) {
-    adcRead.flags.thermistor2DetectedFLG = true;
-    adcRead.connectThermistor++;
-  }
-  else if (adcRead.adcDataARYW[CHAMBER_TEMPERATURE2] >= THERMISTOR_SHORT_ADC_COUNT) {
-    if ( readADCIOStatus(CHAMBER_TEMPERATURE2) == false) {
-      // If IO is high means analog pin is open. Enable to declare thermistor error
-      adcRead.flags.thermistor2DetectedFLG = true;
-      adcRead.connectThermistor++;
+#ifdef SCHEDULER_EVENT_TRIGGER
+  // Let the temperature control run on the fresh scan
+  scheduler.SignalEvent(SCHEDULER_EVENT_ADC_SCAN_COMPLETE);
+#endif
+}
+
+
+#ifdef ADCREAD_DMA_SCAN
+/*
+================================================================================
+Method name:  ADCRead
+                    
+Originator:   
+
+Description: 
+  Call periodically from Scheduler (5 msec). The first call starts the DMA
+  driven scan of all the channels. After that, whenever the DMA has filled a
+  scan buffer, all the channels of that buffer are processed as a block while
+  the DMA fills the other buffer. The results of the CTMU discharge conversions
+  are skipped. The oversampled conversions of a thermistor channel are summed
+  and decimated to ADC_OVERSAMPLE_BITS more than the ADC count.
+
+  This method should be called using adcRead.ReadFunction().
+
+Resources:
+  8 ADC channel inputs, Timer 3, DMA0 and DMA1
+
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+2.6.0  10-16-2026  Thermistor channels are oversampled.
+--------------------------------------------------------------------------------
+*/
+
+bool ADCRead(void)
+{
+  uint8_t channelIndex = 0;
+  uint8_t sampleIndex = 0;
+  uint8_t samples = 0;
+  uint16_t inputIndexW = 0;
+  uint16_t slotW = 0;
+  uint16_t rawDataW = 0;
+  volatile uint16_t *scanPTRW = adcScanBufferARYW[0];
+#ifdef ADCREAD_SELF_CALIBRATION
+  uint16_t zeroSumW = 0;
+#endif
+
+  // Start the DMA scan on the first call
+  if ( adcRead.adcStatus != ADC_DMA_SCAN_RUNNING) {
+    // Input of the first conversion is in the last entry, CTMU before each
+    // channel and then the samples of the channel
+    inputIndexW = ADC_DMA_SCAN_CONVERSIONS - 1;
+    for ( channelIndex = 0; channelIndex < TOTAL_ADC_CHANNELS; channelIndex++) {
+      adcScanInputARYW[inputIndexW] = ADC1_CHANNEL_CTMU;
+      inputIndexW = (inputIndexW + 1) % ADC_DMA_SCAN_CONVERSIONS;
+
+      for ( sampleIndex = 0; sampleIndex < ADC_DMA_CHANNEL_SAMPLES(channelIndex); \
+              sampleIndex++) {
+        adcScanInputARYW[inputIndexW] = adcChannelARY[channelIndex].adcChannel;
+        inputIndexW = (inputIndexW + 1) % ADC_DMA_SCAN_CONVERSIONS;
+      }
     }
-  }
-  else {
-    // Nothing To Do
+
+    ADCReadDMAScanStart(adcScanBufferARYW[0], adcScanBufferARYW[1],       \
+            adcScanInputARYW, ADC_DMA_SCAN_CONVERSIONS, ADC_DMA_CONVERSION_COUNTS, \
+            ADC_DMA_ADCS);
+    adcRead.adcStatus = ADC_DMA_SCAN_RUNNING;
+
+    return TASK_COMPLETED;
   }
 
-  // Check that chamber temperature 3 ADC count is in range
-  if ( (adcRead.adcDataARYW[CHAMBER_TEMPERATURE3] < THERMISTOR_SHORT_ADC_COUNT) && \
-          (adcRead.adcDataARYW[CHAMBER_TEMPERATURE3] > THERMISTOR_OPEN_ADC_COUNT)) {
-    adcRead.flags.thermistor3DetectedFLG = true;
-    adcRead.connectThermistor++;
+  // Nothing to do till the DMA fills the next scan buffer
+  if ( ADCREAD_DMA_SCAN_COMPLETE() == false) {
+    return TASK_COMPLETED;
   }
-  else if (adcRead.adcDataARYW[CHAMBER_TEMPERATURE3] >= THERMISTOR_SHORT_ADC_COUNT) {
-    if ( readADCIOStatus(CHAMBER_TEMPERATURE3) == false) {
-      // If IO is high means analog pin is open. Enable to declare thermistor error
-      adcRead.flags.thermistor3DetectedFLG = true;
-      adcRead.connectThermistor++;
-    }
+  ADCREAD_DMA_SCAN_CLEAR();
+
+  // Buffer not filled by the DMA now has the latest scan
+  if ( ADCREAD_DMA_BUFFER_B_ACTIVE()) {
+    scanPTRW = adcScanBufferARYW[0];
   }
   else {
-    // Nothing To Do
+    scanPTRW = adcScanBufferARYW[1];
   }
 
-  // Check that chamber temperature 4 ADC count is in range
-  if ( (adcRead.adcDataARYW[CHAMBER_TEMPERATURE4] < THERMISTOR_SHORT_ADC_COUNT) && \
-          (adcRead.adcDataARYW[CHAMBER_TEMPERATURE4] > THERMISTOR_OPEN_ADC_COUNT)) {
-    adcRead.flags.thermistor4DetectedFLG = true;
-    adcRead.connectThermistor++;
-  }
-  else if (adcRead.adcDataARYW[CHAMBER_TEMPERATURE4] >= THERMISTOR_SHORT_ADC_COUNT) {
-    if ( readADCIOStatus(CHAMBER_TEMPERATURE4) == false) {
-      // If IO is high means analog pin is open. Enable to declare thermistor error
-      adcRead.flags.thermistor4DetectedFLG = true;
-      adcRead.connectThermistor++;
+  // If inlet thermistor disabled, start with Outlet thermistor
+  for ( channelIndex = ADC_SCAN_FIRST_CHANNEL; channelIndex < TOTAL_ADC_CHANNELS; \
+          channelIndex++) {
+    slotW = ADC_DMA_CHANNEL_SLOT(channelIndex);
+    samples = ADC_DMA_CHANNEL_SAMPLES(channelIndex);
+    rawDataW = scanPTRW[slotW];
+
+    if ( samples > 1) {
+      // Sum of the 16 conversions fits in 16 bits, keep 2 of its 4 extra bits
+      for ( sampleIndex = 1; sampleIndex < samples; sampleIndex++) {
+        rawDataW += scanPTRW[slotW + sampleIndex];
+      }
+      rawDataW >>= ADC_OVERSAMPLE_BITS;
     }
-  }
-  else {
-    // Nothing To Do
-  }
 
-  // If no thermistors are detected consider chamber thermistor 1 detected
-  // to indicate the error code on 7 segment display.
-  if ( (adcRead.flags.thermistor1DetectedFLG == false) && \
-          (adcRead.flags.thermistor2DetectedFLG == false) && \
-          (adcRead.flags.thermistor3DetectedFLG == false) && \
-          (adcRead.flags.thermistor4DetectedFLG == false)) {
-    adcRead.flags.thermistor1DetectedFLG = true;
+    ADCReadProcess(channelIndex, rawDataW);
+#ifdef ADCREAD_SELF_CALIBRATION
+    // Discharged CTMU conversion before the channel is the zero reading
+    zeroSumW += scanPTRW[slotW - 1];
+#endif
   }
-  if(adcRead.connectThermistor >= MINIMUM_THERMISOR_COUNTS){
-      adcRead.flags.validThermistorsFLG = true;
+#ifdef ADCREAD_SELF_CALIBRATION
+  adcRead.zeroDataW = zeroSumW / (TOTAL_ADC_CHANNELS - ADC_SCAN_FIRST_CHANNEL);
+#endif
+
+  ADCReadScanEnd();
+
+  return TASK_COMPLETED;
+}
+#else
+/*
+================================================================================
+Method name:  ADCReadSelectSchedule
+                    
+Originator:   
+
+Description: 
+  The purpose of this function is to select the channel schedule of the next
+  frame by the heater state. While the relays are heating, the weighted
+  schedule converts the outlet & chamber thermistors more often.
+
+  This method should be called using ADCReadSelectSchedule().
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+static void ADCReadSelectSchedule(void)
+{
+  switch ( tempControl.relayStatus) {
+    case RELAY_CONTROL_CONTROL:
+    case RELAY_CONTROL_LOWFLOW:
+    case RELAY_CONTROL_STBYHEAT:
+      adcRead.schedulePTR = adcHeatingScheduleARY;
+      break;
+
+    default:
+      adcRead.schedulePTR = adcIdleScheduleARY;
+      break;
   }
-  else{
-      adcRead.flags.validThermistorsFLG = false;
+
+  adcRead.adcChannelIndex = adcRead.schedulePTR[0];
+}
+
+
+/*
+================================================================================
+Method name:  ADCReadNextSlot
+                    
+Originator:   
+
+Description: 
+  The purpose of this function is to move to the next slot of the channel
+  schedule and to select its channel. This function returns true if the slot
+  is the first one of a scan, which means the previous scan is completed.
+
+  This method should be called using ADCReadNextSlot().
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+static bool ADCReadNextSlot(void)
+{
+  if ( ++adcRead.scheduleSlot >= ADC_SCHEDULE_SLOTS) {
+    adcRead.scheduleSlot = 0;
   }
+  adcRead.adcChannelIndex = adcRead.schedulePTR[adcRead.scheduleSlot];
+
+  return ((adcRead.scheduleSlot % ADC_SCAN_SLOTS) == 0);
 }
 
 
@@ -372,6 +1912,13 @@ Description:
   converted data and checks the minimum maximum ranges for thermistors digital
   data, Moisture detectors digital value and power supply voltage also.
 
+  When SCHEDULER_EVENT_TRIGGER is defined, the scans run back to back and
+  SCHEDULER_EVENT_ADC_SCAN_COMPLETE is signalled at the end of every scan, so
+  the temperature control runs on the fresh data.
+
+  The channels are converted in the order of the schedule selected by the
+  heater state at the start of every ADC_SCHEDULE_SCANS scans frame.
+
   This method should be called using adcRead.ReadFunction().
 
 Resources:
@@ -397,6 +1944,10 @@ Resources:
                    ADC conversion is added.
 2.3.0  09-15-2020  Averaging is made common for all the     Poorana kumar G
                    analog channels 
+2.6.0  10-16-2026  Scan is started once per scan period and
+                   scan complete event is signalled.
+2.6.0  10-16-2026  Channels are converted by the schedule.
+2.6.0  10-16-2026  Scans are not paced to the scan period.
 --------------------------------------------------------------------------------
 */
 
@@ -410,6 +1961,10 @@ bool ADCRead(void)
   {
     // Trigger discharge of sample & hold capacitor
     case ADC_CONV_SH_DISCHARGE_START:
+      // Heater state selects the schedule of the frame
+      if ( adcRead.scheduleSlot == 0) {
+        ADCReadSelectSchedule();
+      }
       ADCReadTriggerDischarge();
       adcRead.adcStatus = ADC_CONV_SH_DISCHARGE_END;
       break;
@@ -427,6 +1982,9 @@ bool ADCRead(void)
 
         // Just to avoid PC-Lint error
         (void) dummyValueW;
+#ifdef ADCREAD_SELF_CALIBRATION
+        adcRead.zeroDataW = dummyValueW;
+#endif
 
         adcRead.adcStatus = ADC_CONV_SAMPLING_START;
       }
@@ -434,7 +1992,7 @@ bool ADCRead(void)
 
     // Select actual channel & Start sampling
     case ADC_CONV_SAMPLING_START:
-      ADCREAD_CHANNEL_SELECT(ADCReadChannels[adcRead.adcChannelIndex]);
+      ADCREAD_CHANNEL_SELECT(adcChannelARY[adcRead.adcChannelIndex].adcChannel);
       ADCREAD_START_SAMPLING();
       adcRead.adcStatus = ADC_CONV_SAMPLING_END;
       break;
@@ -448,100 +2006,13 @@ bool ADCRead(void)
     case ADC_CONV_READ_DATA:
       // Check ADC conversion status
       if ( ADCREAD_CONVERSION_COMPLETE() == true) {
-        // Read the register which have the digital data
-        adcRead.adcDataARYW[adcRead.adcChannelIndex] = ADCREAD_READ_REGISTER();
-
-        adcRead.adcDataARYW[adcRead.adcChannelIndex] =                            \
-                LowPassFilter(&adcRead.adcDataFilterARYW[adcRead.adcChannelIndex],\
-                adcRead.adcDataARYW[adcRead.adcChannelIndex]);
-
-        // Double temperatures so when we average we do not lose resolution
-        // After averaged that it is converted to the format of actual one used.
-        if ( (adcRead.adcChannelIndex != MOISTURE_DETECTOR) &&          \
-                (adcRead.adcChannelIndex != VCC_VOLTAGE)) {
-          adcRead.adcDataARYW[adcRead.adcChannelIndex] =                \
-                  (ADC_FULL_COUNT - adcRead.adcDataARYW[adcRead.adcChannelIndex]) * 2;
-        }
-
-        // After power ON thermistor detection completed
-        if ( adcRead.powerONADCDetTimer == 0 ) {
-          switch(adcRead.adcChannelIndex) {
-            // Inlet & Outlet thermistor ADC count error check
-            case INLET_TEMPERATURE:
-            case OUTLET_TEMPERATURE:
-              checkThermistorError(adcRead.adcChannelIndex);
-              break;
-
-            case CHAMBER_TEMPERATURE1:
-              // If Chamber thermistor 1 is detected
-              if ( adcRead.flags.thermistor1DetectedFLG == true) {
-                // Chamber thermistor 1 ADC count error check
-                checkThermistorError(CHAMBER_TEMPERATURE1);
-              }
-              break;
-
-            case CHAMBER_TEMPERATURE2:
-              // If Chamber thermistor 2 is detected
-              if ( adcRead.flags.thermistor2DetectedFLG == true) {
-                // Chamber thermistor 2 ADC count error check
-                checkThermistorError(CHAMBER_TEMPERATURE2);
-              }
-              break;
-
-            case CHAMBER_TEMPERATURE3:
-              // If Chamber thermistor 3 is detected
-              if ( adcRead.flags.thermistor3DetectedFLG == true) {
-                // Chamber thermistor 3 ADC count error check
-                checkThermistorError(CHAMBER_TEMPERATURE3);
-              }
-              break;
-
-            case CHAMBER_TEMPERATURE4:
-              // If Chamber thermistor 4 is detected
-              if ( adcRead.flags.thermistor4DetectedFLG == true) {
-                // Chamber thermistor 4 ADC count error check
-                checkThermistorError(CHAMBER_TEMPERATURE4);
-              }
-              break;
-
-            case MOISTURE_DETECTOR:
-              // Moisture detector ADC count error check
-              // Clearing leak detection error only by power reset
-              if ( (adcRead.adcDataARYW[MOISTURE_DETECTOR] < MOISTURE_DETECTOR_LEAK_COUNT) ||\
-                      (adcRead.adcDataARYW[MOISTURE_DETECTOR] > MOISTURE_DETECTOR_UPPER_THRESHOLD)) {
-                // Declare leak detection error
-                faultIndication.Error(LEAKAGE_ERROR);
-              }
-              break;
-
-            case VCC_VOLTAGE:
-              // DC Supply voltage monitor
-              checkVccError();
-              break;
-              
-            default:
-              break;
-          }
-        }
+        // Read the register which have the digital data and process it
+        ADCReadProcess(adcRead.adcChannelIndex, ADCREAD_READ_REGISTER());
 
-        // Increment the channel index and if converted all channels
-        if ( ++adcRead.adcChannelIndex >= TOTAL_ADC_CHANNELS) {
-          // Reset the channel index
-#ifdef DISABLE_INLET_THERMISTOR
-          // If inlet thermistor disabled, start with Outlet thermistor
-          adcRead.adcChannelIndex = OUTLET_TEMPERATURE;
-#else
-          adcRead.adcChannelIndex = INLET_TEMPERATURE;
-#endif
-
-          // Wait for timer to become 0 to detect the chamber thermistors
-          if ( adcRead.powerONADCDetTimer != 0 ) {
-            adcRead.powerONADCDetTimer--;
-
-            if ( adcRead.powerONADCDetTimer == 0 ) {
-              adcRead.DetectThermistor();
-            }
-          }
+        // Select the channel of the next slot and if converted all slots of
+        // the scan
+        if ( ADCReadNextSlot() == true) {
+          ADCReadScanEnd();
         }
 
         retVal = TASK_COMPLETED;
@@ -556,4 +2027,4 @@ bool ADCRead(void)
 
   return retVal;
 }
-
+#endif
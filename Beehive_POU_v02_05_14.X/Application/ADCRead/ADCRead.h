@@ -12,6 +12,27 @@ Description:
   This class is responsible for reading all the 4 analog input channels one by
   one periodically. It will read the converted data and process it.
 
+  When ADCREAD_DMA_SCAN is defined, Timer 3 triggers the conversions and the
+  DMA selects the input of each conversion and stores the result in a ping-pong
+  scan buffer. A CTMU conversion is done before each channel to discharge the
+  sample & hold capacitor. All the 8 channels are converted in every 10 ms
+  without CPU, and ADCRead() processes the latest scan buffer as a block.
+  With ADCREAD_OVERSAMPLING, each thermistor channel is converted
+  ADC_OVERSAMPLE_COUNT times in the same 10 ms scan at a shorter conversion
+  period, and the conversions are decimated to 14 bits.
+
+  The ADC reference is AVDD and AVSS (AD1CON2 VCFG = 0), and AVDD is the same
+  5V supply that feeds the thermistor and the moisture detector dividers. So
+  their counts are the ratio of the divider resistances and do not change with
+  the supply voltage, there is no supply correction of the counts. The 5V
+  supply is read on VCC_VOLTAGE through a divide by 2 resistor divider, 2048
+  counts at any supply voltage, and is only checked for the DC supply error.
+
+  When ADCREAD_LAG_COMPENSATION is defined, compensatedARYW has the thermistor
+  data with a first order lead, the slope times the time constant of the
+  channel role. It is an estimate of the water temperature in place of the
+  lagging thermistor temperature.
+
 Class Methods:
   void ADCRead(void);
     Call periodically from Scheduler (125msec), to trigger the ADC conversion of
@@ -32,6 +53,9 @@ IoTranslate requirements:
   #define ADCREAD_START_SAMPLING()
   #define ADCREAD_CONVERSION_COMPLETE()
   #define ADCREAD_READ_REGISTER()
+  #define ADCREAD_DMA_SCAN_COMPLETE()
+  #define ADCREAD_DMA_SCAN_CLEAR()
+  #define ADCREAD_DMA_BUFFER_B_ACTIVE()
 
 ================================================================================
  History:	
@@ -41,6 +65,33 @@ IoTranslate requirements:
                    updated the functions
 2.2.0  07-16-2020  Macro to disable the inlet temperature   Poorana kumar G
                    ADC conversion is added.
+2.6.0  10-16-2026  Scan period pacing and scan complete
+                   event are added.
+2.6.0  10-16-2026  DMA driven scan of all the channels is
+                   added.
+2.6.0  10-16-2026  Per channel filter bank is added.
+2.6.0  10-16-2026  Thermistor pin probe is run over the
+                   scans with the results cached.
+2.6.0  10-16-2026  Weighted channel schedule selected by
+                   the heater state is added.
+2.6.0  10-16-2026  Sample history and slope of the
+                   thermistor channels are added.
+2.6.0  10-16-2026  Plausibility of the chamber thermistors
+                   is added.
+2.6.0  10-16-2026  Channel descriptor table and the mask of
+                   detected chamber thermistors replace the
+                   detected flags. Re-detection is added.
+2.6.0  10-16-2026  Offset & gain self calibration is added.
+2.6.0  10-16-2026  Oversampling of the thermistor channels
+                   in the DMA scan is added. Filter registers
+                   are 32 bits.
+2.6.0  10-16-2026  Lag compensated thermistor data is
+                   added.
+2.6.0  10-16-2026  Biquad filter type is added, the moving
+                   average is done by the DSP kernel.
+2.6.0  10-16-2026  ADC clock and the shortest sampling of
+                   the DMA scan are added.
+2.6.0  10-16-2026  Scan period pacing is removed.
 --------------------------------------------------------------------------------
 */
 
@@ -61,32 +112,185 @@ typedef enum {
   ADC_CONV_DUMMY_READ,
   ADC_CONV_SAMPLING_START,
   ADC_CONV_SAMPLING_END,
-  ADC_CONV_READ_DATA
+  ADC_CONV_READ_DATA,
+  ADC_DMA_SCAN_RUNNING
 }ADCState_ETYP;
 
+// Enums for the thermistor pin probe
+typedef enum {
+  ADC_PROBE_IDLE = 0,
+  ADC_PROBE_SETTLING,                   // Pins are GPIO with pull up
+  ADC_PROBE_RESTORING                   // Pins are analog inputs again
+}ADCProbeState_ETYP;
+
+// Enums for the role of an ADC channel
+typedef enum {
+  ADC_ROLE_PIPE_THERMISTOR = 0,         // Inlet or outlet, always fitted
+  ADC_ROLE_CHAMBER_THERMISTOR,          // Fitted if detected
+  ADC_ROLE_MOISTURE,
+  ADC_ROLE_SUPPLY
+}ADCChannelRole_ETYP;
+
+// Descriptor of an ADC channel. The counts are in ADC half units for the
+// thermistors and in ADC counts for the others.
+typedef struct {
+  ADC1_CHANNEL adcChannel;              // ADC input of the channel
+  ADCChannelRole_ETYP role;
+  uint16_t lowCountW;                   // Open error below this count
+  uint16_t highCountW;                  // Short error above this count
+  // Errors_ETYP of the low and high counts, FaultIndication.h includes this
+  // file through IoTranslate.h
+  uint8_t lowError;
+  uint8_t highError;
+  uint16_t lagTauW;                     // Thermal time constant in ms, 0 none
+} ADCChannel_STYP;
+
+// Filtered sample of a thermistor channel with the tick it is processed
+typedef struct {
+  uint16_t tickW;                       // Scheduler tick count
+  uint16_t dataW;                       // Filtered data in ADC fine units
+} ADCSample_STYP;
+
+// Size of the sample history, power of 2, and the minimum time in ms between
+// its entries, 8 x 125 ms = 1 Sec
+#define ADC_HISTORY_SIZE                    8
+#define ADC_HISTORY_PERIOD                  125
+// Entries older than this in ms are not used for the slope
+#define ADC_HISTORY_MAX_AGE                 8000
+
+// Thermal time constant of the thermistors by the channel role in ms, the
+// lead of the lag compensation is the slope over ADC_LAG_SLOPE_WINDOW times
+// the time constant, limited to ADC_LAG_MAX_LEAD
+#define ADC_LAG_TAU_PIPE                    3000
+#define ADC_LAG_TAU_CHAMBER                 2000
+#define ADC_LAG_SLOPE_WINDOW                500     // ms
+#define ADC_LAG_MAX_LEAD                    400     // Half units
+
+// Plausibility of the chamber thermistors. A change faster than the slew
+// limit, which is also away from the median of the peer thermistors, is held
+// till it is seen in ADC_PLAUSIBLE_CONFIRM samples in a row.
+#define ADC_CHAMBER_CHANNELS                4
+#define ADC_PLAUSIBLE_SLEW                  600     // Half units per second
+#define ADC_PLAUSIBLE_NOISE                 64      // Half units
+#define ADC_PLAUSIBLE_PEER_BAND             600     // Half units
+#define ADC_PLAUSIBLE_CONFIRM               3       // Samples
+
+// Filter types of the ADC filter bank
+typedef enum {
+  ADC_FILTER_IIR = 0,                   // First order IIR, length is the shift
+  ADC_FILTER_AVERAGE,                   // Moving average of length samples
+  ADC_FILTER_MEDIAN,                    // Median of length (3 or 5) samples
+  ADC_FILTER_BIQUAD,                    // Butterworth, length is the cutoff
+  ADC_FILTER_TYPES
+}ADCFilterType_ETYP;
+
+// Filter of one ADC channel
+typedef struct {
+  uint8_t type;                         // ADCFilterType_ETYP
+  uint8_t length;                       // Shift, taps or points of the filter
+} ADCFilter_STYP;
+
+// Limits of the filter length
+#define ADC_FILTER_MAX_SHIFTS               4       // IIR shift, 2^4 = 16
+#define ADC_FILTER_MAX_TAPS                 8       // Average taps, history
+// Biquad cutoffs, 1 is 1/8 and 2 is 1/16 of the sample rate of the channel
+#define ADC_FILTER_BIQUAD_CUTOFFS           2
+
+// Build time filter of each channel, in the order of the ADC array index.
+// Chamber thermistors use the median filter, so a single noisy sample does not
+// trip the dry fire or over heat check and a real step is seen after 3 samples
+// instead of the slow IIR settling.
+#define ADC_FILTER_BANK_DEFAULTS {                                              \
+          {ADC_FILTER_IIR, ADC_FILTER_SHIFTS},      /* Inlet temperature */     \
+          {ADC_FILTER_IIR, ADC_FILTER_SHIFTS},      /* Outlet temperature */    \
+          {ADC_FILTER_MEDIAN, 5},                   /* Chamber temperature 1 */ \
+          {ADC_FILTER_MEDIAN, 5},                   /* Chamber temperature 2 */ \
+          {ADC_FILTER_MEDIAN, 5},                   /* Chamber temperature 3 */ \
+          {ADC_FILTER_MEDIAN, 5},                   /* Chamber temperature 4 */ \
+          {ADC_FILTER_AVERAGE, 8},                  /* Moisture detector */     \
+          {ADC_FILTER_AVERAGE, 8}                   /* Vcc voltage */           \
+        }
 
 //CLASS OBJECT DEFINITION
 typedef struct {
 //  Public Variables
   struct {
-    uint8_t thermistor1DetectedFLG:1;
-    uint8_t thermistor2DetectedFLG:1;
-    uint8_t thermistor3DetectedFLG:1;
-    uint8_t thermistor4DetectedFLG:1;
     uint8_t validThermistorsFLG:1;
   }flags;
+  // Detected chamber thermistors, one bit per ADC array index
+  uint8_t detectedMask;
   uint16_t adcDataARYW[TOTAL_ADC_CHANNELS];
-  uint16_t adcDataFilterARYW[TOTAL_ADC_CHANNELS];
+  // Lag compensated thermistor data, same as adcDataARYW without
+  // ADCREAD_LAG_COMPENSATION
+  uint16_t compensatedARYW[TOTAL_THERMISTORS];
+  // IIR filter register of the channel
+  uint32_t adcDataFilterARYL[TOTAL_ADC_CHANNELS];
+  ADCFilter_STYP filterBankARY[TOTAL_ADC_CHANNELS];  // Filter of the channel
 
 // Public Methods
   bool (*ReadFunction)(void);           // The read function used periodically
   void (*DetectThermistor)(void);       // 
+  // Change the filter of a channel
+  bool (*SetFilter)(uint8_t channelIndex, uint8_t type, uint8_t length);
+  // Slope of a thermistor channel in ADC half units per second
+  int16_t (*Slope)(uint8_t channelIndex, uint16_t windowW);
+  // Load the self calibration stored with the settings
+  void (*LoadCalibration)(void);
 
 // Private Variables
   uint8_t adcChannelIndex;              // Index into ADC channel
   uint8_t connectThermistor;            // Number of Connected Thermistor
   uint8_t powerONADCDetTimer;           // Timer to delay the detection of ADC
-  ADCState_ETYP adcStatus;              // ADC Conversion status
+  volatile ADCState_ETYP adcStatus;     // ADC Conversion status
+  // Samples of the moving average and median filters, the state of the
+  // biquad filter
+  uint16_t filterHistoryARYW[TOTAL_ADC_CHANNELS][ADC_FILTER_MAX_TAPS];
+  uint8_t filterIndexARY[TOTAL_ADC_CHANNELS];   // Next history position
+  uint8_t filterCountARY[TOTAL_ADC_CHANNELS];   // Samples in the history
+  // Thermistor pin probe, one bit per ADC array index in the masks
+  ADCProbeState_ETYP probeState;
+  uint8_t probeRequestMask;             // Pins to be probed
+  uint8_t probeMask;                    // Pins being probed, samples discarded
+  uint8_t probeValidMask;               // Pins with a probe result
+  uint8_t probeOpenMask;                // Pins read high, thermistor is open
+  uint8_t probeTimer;                   // Scans till the next probe
+  // Channel schedule selected at the start of the frame and its present slot
+  const uint8_t *schedulePTR;
+  uint8_t scheduleSlot;
+  // Sample history of the thermistor channels, one entry per
+  // ADC_HISTORY_PERIOD
+  ADCSample_STYP historyARY[TOTAL_THERMISTORS][ADC_HISTORY_SIZE];
+  uint8_t historyHeadARY[TOTAL_THERMISTORS];    // Next entry to be written
+  uint8_t historyCountARY[TOTAL_THERMISTORS];   // Entries in the history
+#ifdef ADCREAD_PLAUSIBILITY
+  // Plausibility of the chamber thermistors, index 0 is chamber thermistor 1
+  uint16_t plausibleDataARYW[ADC_CHAMBER_CHANNELS];  // Last accepted data
+  uint16_t plausibleTickARYW[ADC_CHAMBER_CHANNELS];  // Tick of the accepted data
+  uint8_t plausiblePendingARY[ADC_CHAMBER_CHANNELS]; // Implausible in a row
+  uint16_t suppressedCountARYW[ADC_CHAMBER_CHANNELS];  // Samples held
+#endif
+  // Chamber thermistor 1 taken as detected only to show its error, when no
+  // chamber thermistor is detected
+  uint8_t forcedMask;
+  uint8_t redetectTimer;                // Scans till the next re-detection
+  // Re-detection checks in range in a row, index 0 is chamber thermistor 1
+  uint8_t redetectCountARY[ADC_CHAMBER_CHANNELS];
+#ifdef ADCREAD_SELF_CALIBRATION
+  // Discharged CTMU conversion of the last scan, the zero reading
+  volatile uint16_t zeroDataW;
+  int16_t adcOffsetW;                   // Subtracted from the raw counts
+  // Gain is 1 + trim in ADC_CALIBRATION_SHIFT fixed point
+  int16_t adcGainTrimW;
+  uint16_t calibrationScansW;           // Scans in the present pass
+  uint32_t zeroSumL;                    // Zero readings of the pass
+  uint32_t vccSumL;                     // Raw VCC/2 readings of the pass
+  uint16_t vccSamplesW;                 // VCC/2 readings of the pass
+#endif
+#ifdef ADCREAD_LAG_COMPENSATION
+  // Lead added to the thermistor data in half units, updated once per
+  // history entry
+  int16_t leadARYW[TOTAL_THERMISTORS];
+#endif
 } ADCRead_STYP;
 
 
@@ -94,11 +298,17 @@ typedef struct {
 #ifdef DISABLE_INLET_THERMISTOR
 
 #define ADC_READ_DEFAULTS {                                 \
-                            {0,0,0,0},                      \
+                            {0},                            \
+                            0,                              \
                             {0,0,0,0,0,0,0,0},              \
+                            {0,0,0,0,0,0},                  \
                             {0,0,0,0,0,0,0,0},              \
+                            ADC_FILTER_BANK_DEFAULTS,       \
                             &ADCRead,                       \
                             &chamberThermistorDectection,   \
+                            &ADCReadSetFilter,              \
+                            &ADCReadSlope,                  \
+                            &ADCReadLoadCalibration,        \
                             OUTLET_TEMPERATURE,             \
                             0,                              \
                             POWERON_ADC_DETECTION_TIME,     \
@@ -108,12 +318,19 @@ typedef struct {
 #else
 
 #define ADC_READ_DEFAULTS {                                 \
-                            {0,0,0,0},                      \
+                            {0},                            \
+                            0,                              \
                             {0,0,0,0,0,0,0,0},              \
+                            {0,0,0,0,0,0},                  \
                             {0,0,0,0,0,0,0,0},              \
+                            ADC_FILTER_BANK_DEFAULTS,       \
                             &ADCRead,                       \
                             &chamberThermistorDectection,   \
+                            &ADCReadSetFilter,              \
+                            &ADCReadSlope,                  \
+                            &ADCReadLoadCalibration,        \
                             INLET_TEMPERATURE,              \
+                            0,                              \
                             POWERON_ADC_DETECTION_TIME,     \
                             ADC_CONV_SH_DISCHARGE_START     \
                           }
@@ -134,9 +351,36 @@ typedef struct {
 #define POWER_SUPPLY_ADC_COUNT              2048    // Count for 2.5V
 #define POWER_SUPPLY_TOLERANCE              5       // 5%
 #define POWER_SUPPLY_MIN_VOLTAGE            4500    // in mVolt
+// ADC self calibration. The offset is the mean zero reading and the gain maps
+// the mean VCC/2 reading (less the offset) to POWER_SUPPLY_ADC_COUNT. The VCC/2
+// reading is ratiometric, so the gain trim takes out the ADC gain error and not
+// a supply error.
+#define ADC_CALIBRATION_SHIFT               12      // Gain 1.0 = 2^12
+#define ADC_CALIBRATION_MAX_OFFSET          32      // ADC counts, either sign
+#define ADC_CALIBRATION_MAX_TRIM            82      // 82/4096 = 2%
+// Change from the stored calibration which is written to the settings
+#define ADC_CALIBRATION_STORE_DELTA         2
+#ifdef ADCREAD_DMA_SCAN
+#define ADC_FILTER_SHIFTS                   4       // 2^4 = 16 count avg
+#define POWERON_ADC_DETECTION_TIME          200     // 200 * 10ms = 2 Sec
+#else
 #define ADC_FILTER_SHIFTS                   2       // 2^2 = 4 count avg
 #define POWERON_ADC_DETECTION_TIME          4       // 4 * 0.5s = 2 Sec
+#endif
 //#define POWERON_ADC_DETECTION_TIME          20      // 20 * 0.1s = 2 Sec
+#ifdef ADCREAD_DMA_SCAN
+#define ADC_PROBE_INTERVAL_SCANS            100     // 100 * 10ms = 1 Sec
+#define ADC_CALIBRATION_PERIOD_SCANS        6000    // 6000 * 10ms = 60 Sec
+#else
+#define ADC_PROBE_INTERVAL_SCANS            2       // 2 * 0.5s = 1 Sec
+#define ADC_CALIBRATION_PERIOD_SCANS        120     // 120 * 0.5s = 60 Sec
+#endif
+// Chamber thermistor pins probed for the power ON detection
+#define ADC_PROBE_CHAMBER_MASK              0x3C
+// Undetected chamber thermistors are checked once per interval and detected
+// after they are in range for ADC_REDETECT_CONFIRM checks in a row
+#define ADC_REDETECT_INTERVAL_SCANS         ADC_PROBE_INTERVAL_SCANS    // 1 Sec
+#define ADC_REDETECT_CONFIRM                5
 #define MINIMUM_THERMISOR_COUNTS            3
 
 // ADC Array index 
@@ -149,13 +393,81 @@ typedef struct {
 #define MOISTURE_DETECTOR                   6
 #define VCC_VOLTAGE                         7
 
+// Bit of the ADC array index in the channel masks
+#define ADC_CHANNEL_BIT(channelIndex)       ((uint8_t) (1 << (channelIndex)))
+// True if the chamber thermistor of the ADC array index is detected
+#define ADCREAD_DETECTED(channelIndex)                                          \
+          ((adcRead.detectedMask & ADC_CHANNEL_BIT(channelIndex)) != 0)
+
+// First channel of the ADC scan
+#ifdef DISABLE_INLET_THERMISTOR
+#define ADC_SCAN_FIRST_CHANNEL              OUTLET_TEMPERATURE
+#else
+#define ADC_SCAN_FIRST_CHANNEL              INLET_TEMPERATURE
+#endif
+
+// Channel slots of one scan, and of the schedule frame of ADC_SCHEDULE_SCANS
+// scans. Every channel is converted at least once per frame in any schedule.
+#define ADC_SCAN_SLOTS                      (TOTAL_ADC_CHANNELS - ADC_SCAN_FIRST_CHANNEL)
+#define ADC_SCHEDULE_SCANS                  4
+#define ADC_SCHEDULE_SLOTS                  (ADC_SCAN_SLOTS * ADC_SCHEDULE_SCANS)
+
+// Oversampling of the thermistor channels. The 16 conversions are summed and
+// decimated to 14 bits. The thermistor data in ADC half units keeps one of the
+// 2 extra bits, the sample history for the slope keeps both in the ADC fine
+// units (half units << ADC_FINE_SHIFT).
+#ifdef ADCREAD_OVERSAMPLING
+#define ADC_OVERSAMPLE_COUNT                16
+#define ADC_OVERSAMPLE_BITS                 2
+#define ADC_FINE_SHIFT                      1
+#else
+#define ADC_OVERSAMPLE_COUNT                1
+#define ADC_OVERSAMPLE_BITS                 0
+#define ADC_FINE_SHIFT                      0
+#endif
+
+// DMA scan converts the CTMU before each channel, followed by
+// ADC_OVERSAMPLE_COUNT conversions of a thermistor channel or one of the
+// others. The first result of the channel is in ADC_DMA_CHANNEL_SLOT().
+#define ADC_DMA_CHANNEL_SAMPLES(channelIndex)                                   \
+          (((channelIndex) < TOTAL_THERMISTORS) ? ADC_OVERSAMPLE_COUNT : 1)
+#define ADC_DMA_SCAN_CONVERSIONS                                                \
+          ((TOTAL_THERMISTORS * (ADC_OVERSAMPLE_COUNT + 1)) +                   \
+          ((TOTAL_ADC_CHANNELS - TOTAL_THERMISTORS) * 2))
+#define ADC_DMA_CHANNEL_SLOT(channelIndex)                                      \
+          (((channelIndex) < TOTAL_THERMISTORS) ?                               \
+          (((channelIndex) * (ADC_OVERSAMPLE_COUNT + 1)) + 1) :                 \
+          ((TOTAL_THERMISTORS * (ADC_OVERSAMPLE_COUNT + 1)) +                   \
+          (((channelIndex) - TOTAL_THERMISTORS) * 2) + 1))
+// Timer 3 counts (Fcy 15 MHz) per scan of 10 ms and per conversion, 625 us
+// for 16 conversions or 94 us for 106 conversions with the oversampling
+#define ADC_DMA_SCAN_COUNTS                 150000
+#define ADC_DMA_CONVERSION_COUNTS           (ADC_DMA_SCAN_COUNTS / ADC_DMA_SCAN_CONVERSIONS)
+// ADC clock of the DMA scan, TAD = (ADCS + 1) Tcy = 200 ns, above the 117.6 ns
+// minimum of the 12-bit mode
+#define ADC_DMA_ADCS                        2
+#define ADC_DMA_TAD_COUNTS                  (ADC_DMA_ADCS + 1)
+// 12-bit conversion time
+#define ADC_DMA_CONVERSION_TAD              14
+// Sampling runs from the end of the conversion to the next Timer 3 compare.
+// The thermistor divider is sampled right after the discharge by the CTMU
+// conversion, so it needs 50 us, far above the minimum of 3 TAD.
+#define ADC_DMA_MIN_SAMPLE_TAD              250     // 250 * 200 ns = 50 us
+// Shortest conversion period, the conversion and the sampling
+#define ADC_DMA_MIN_CONVERSION_COUNTS                                           \
+          ((ADC_DMA_CONVERSION_TAD + ADC_DMA_MIN_SAMPLE_TAD) * ADC_DMA_TAD_COUNTS)
+
 //  CLASS METHOD PROTOTYPES
 void chamberThermistorDectection(void);
 bool ADCRead(void);
+bool ADCReadSetFilter(uint8_t channelIndex, uint8_t type, uint8_t length);
+int16_t ADCReadSlope(uint8_t channelIndex, uint16_t windowW);
+void ADCReadLoadCalibration(void);
 
 
 // EXTERN VARIABLES
 extern ADCRead_STYP adcRead;
+extern const ADCChannel_STYP adcChannelARY[TOTAL_ADC_CHANNELS];
 
 #endif /* _ADCREAD_H */
 
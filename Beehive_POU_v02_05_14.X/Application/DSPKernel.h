@@ -0,0 +1,358 @@
+/*
+================================================================================
+File name:    DSPKernel.h
+
+Originator:
+
+Platform:     dsPIC33EV64GM006
+Compiler:     XC16 V1.40
+IDE     :     MPLAB X IDE V5.20
+
+Description:
+  Fixed point kernels for the filters and the PID on the DSP engine. With XC16
+  the products are done by the single cycle MUL instructions, and the Q15 sums
+  are kept in the 40 bit accumulator A by MAC and stored with rounding and
+  saturation by SAC.R. With other compilers, e.g. for a host test, the same
+  results are given by the portable C versions.
+
+  The Q15 kernels take 16 bit signed operands, so the ADC data (14 bits at
+  most) is used as it is. The accumulator A is not saved by the interrupts, so
+  the kernels must not be called from an interrupt.
+
+  DSP_KERNEL_INIT() selects the fractional multiply, the conventional rounding
+  and the saturation in CORCON, and should be called once at startup.
+
+  DSPPIDStep() does not use MAC and SAC.R. The PID gains are 0.0015 to 0.75
+  by default and any float through the UART, and the doubled integral term
+  reaches 212400, 18 bits. Neither fits a 16 bit MAC operand: in Q15 KP would
+  be 49 (0.3% off) and KI 79 (0.5% off), gains of 1 and more could not be
+  held, and the sums of the 32 bit products can go above the 40 bit
+  accumulator.
+  So the gains are 32 bits in PID_GAIN_SHIFT fixed point and the products are
+  made of 16 x 16 bit MUL instructions and summed in 64 bits, which keeps the
+  power the same as the float calculation (Test/PIDEquivalence).
+
+Class Methods:
+  None
+
+Resources:
+  DSP engine, accumulator A
+================================================================================
+ History:
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+2.6.0  10-16-2026  Reason of the 64 bit PID step is noted.
+--------------------------------------------------------------------------------
+*/
+
+
+#ifndef _DSPKERNEL_H_
+#define _DSPKERNEL_H_
+
+#include <stdint.h>
+#ifdef __XC16__
+#include <xc.h>
+#endif
+
+// Coefficients of a biquad section in Q14, {b0, b1, b2, -a1, -a2}
+#define DSP_BIQUAD_COEFFICIENTS     5
+// State of a biquad section, {x[n-1], x[n-2], y[n-1], y[n-2]}
+#define DSP_BIQUAD_STATES           4
+
+// Largest count of the moving average
+#define DSP_AVERAGE_MAX_COUNT       8
+
+#ifdef __XC16__
+// Fractional multiply, SAC.R rounds half up, accumulator A saturates at 40
+// bits and the stores from the accumulator saturate at 16 bits
+#define DSP_KERNEL_INIT()                                                     \
+  do {                                                                        \
+    CORCONbits.IF = 0;                                                        \
+    CORCONbits.RND = 1;                                                       \
+    CORCONbits.SATA = 1;                                                      \
+    CORCONbits.ACCSAT = 1;                                                    \
+    CORCONbits.SATDW = 1;                                                     \
+  } while ( 0)
+#else
+#define DSP_KERNEL_INIT()
+#endif
+
+// Q15 reciprocal of the moving average count rounded down, the count of 1 is
+// not used
+static const int16_t dspReciprocalARYW[DSP_AVERAGE_MAX_COUNT + 1] =
+{
+  0, 32767, 16384, 10922, 8192, 6553, 5461, 4681, 4096
+};
+
+
+#ifndef __XC16__
+/*
+================================================================================
+Method name:  DSPSaturate
+
+Originator:
+
+Description:
+  The purpose of this function is to return the sum saturated to 16 bits, as
+  the store from the accumulator does.
+
+  This method should be called using DSPSaturate().
+
+Resources:
+  None
+================================================================================
+ History:
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+static inline int16_t DSPSaturate(int64_t sumLL)
+{
+  if ( sumLL > INT16_MAX) {
+    sumLL = INT16_MAX;
+  }
+  else if ( sumLL < INT16_MIN) {
+    sumLL = INT16_MIN;
+  }
+
+  return (int16_t) sumLL;
+}
+#endif
+
+
+/*
+================================================================================
+Method name:  DSPMultiply32
+
+Originator:
+
+Description:
+  The purpose of this function is to return the 64 bit product of two 32 bit
+  numbers. The product is made of four 16 x 16 bit products, which is shorter
+  than the 64 x 64 bit multiply of the library.
+
+  This method should be called using DSPMultiply32().
+
+Resources:
+  None
+================================================================================
+ History:
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+static inline int64_t DSPMultiply32(int32_t multiplicandL, int32_t multiplierL)
+{
+#ifdef __XC16__
+  int16_t multiplicandHighW = (int16_t) (multiplicandL >> 16);
+  int16_t multiplierHighW = (int16_t) (multiplierL >> 16);
+  uint16_t multiplicandLowW = (uint16_t) multiplicandL;
+  uint16_t multiplierLowW = (uint16_t) multiplierL;
+  int64_t productLL;
+
+  productLL = (int64_t) __builtin_mulss(multiplicandHighW, multiplierHighW) << 32;
+  productLL += (int64_t) __builtin_mulsu(multiplicandHighW, multiplierLowW) << 16;
+  productLL += (int64_t) __builtin_mulsu(multiplierHighW, multiplicandLowW) << 16;
+  productLL += __builtin_muluu(multiplicandLowW, multiplierLowW);
+
+  return productLL;
+#else
+  return (int64_t) multiplicandL * multiplierL;
+#endif
+}
+
+
+/*
+================================================================================
+Method name:  DSPDotProduct
+
+Originator:
+
+Description:
+  The purpose of this function is to return the sum of the products of the
+  count Q15 numbers of the two arrays, in Q15 rounded and saturated to 16 bits.
+  The sum is kept in the 40 bit accumulator, so it can be above 16 bits till
+  it is stored.
+
+  This method should be called using DSPDotProduct().
+
+Resources:
+  Accumulator A
+================================================================================
+ History:
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+static inline int16_t DSPDotProduct(const int16_t *xPTR, const int16_t *yPTR,
+        uint8_t count)
+{
+  uint8_t index;
+#ifdef __XC16__
+  register int accumulator asm("A");
+
+  accumulator = __builtin_clr();
+  for ( index = 0; index < count; index++) {
+    accumulator = __builtin_mac(accumulator, xPTR[index], yPTR[index],
+            0, 0, 0, 0, 0, 0, 0, 0);
+  }
+
+  return (int16_t) __builtin_sacr(accumulator, 0);
+#else
+  int64_t sumLL = 0;
+
+  for ( index = 0; index < count; index++) {
+    sumLL += (int32_t) xPTR[index] * yPTR[index];
+  }
+
+  return DSPSaturate((sumLL + 16384) >> 15);
+#endif
+}
+
+
+/*
+================================================================================
+Method name:  DSPMovingAverage
+
+Originator:
+
+Description:
+  The purpose of this function is to return the average of the count samples,
+  1 to DSP_AVERAGE_MAX_COUNT. The samples are multiplied by the Q15 reciprocal
+  of the count and summed in the accumulator, so no division is done. The
+  first samples get one more, so the weights sum to exactly 1 and the average
+  of the 14 bit samples is within about 1 of the true average.
+
+  This method should be called using DSPMovingAverage().
+
+Resources:
+  Accumulator A
+================================================================================
+ History:
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+static inline int16_t DSPMovingAverage(const int16_t *samplePTR, uint8_t count)
+{
+  int16_t weightARYW[DSP_AVERAGE_MAX_COUNT];
+  uint16_t remainderW;
+  uint8_t index;
+
+  if ( count <= 1) {
+    return (count == 1) ? samplePTR[0] : 0;
+  }
+  if ( count > DSP_AVERAGE_MAX_COUNT) {
+    count = DSP_AVERAGE_MAX_COUNT;
+  }
+
+  remainderW = 32768U - ((uint16_t) dspReciprocalARYW[count] * count);
+  for ( index = 0; index < count; index++) {
+    weightARYW[index] = dspReciprocalARYW[count] + ((index < remainderW) ? 1 : 0);
+  }
+
+  return DSPDotProduct(samplePTR, weightARYW, count);
+}
+
+
+/*
+================================================================================
+Method name:  DSPBiquad
+
+Originator:
+
+Description:
+  The purpose of this function is to filter the input by a biquad section in
+  the direct form I with the Q14 coefficients, and to return the output. The
+  five products are summed in the accumulator and the output is rounded and
+  saturated to 16 bits only once.
+
+  This method should be called using DSPBiquad().
+
+Resources:
+  Accumulator A
+================================================================================
+ History:
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+static inline int16_t DSPBiquad(int16_t *statePTR, const int16_t *coefficientPTR,
+        int16_t input)
+{
+  int16_t outputW;
+  uint8_t index;
+#ifdef __XC16__
+  register int accumulator asm("A");
+
+  accumulator = __builtin_mpy(input, coefficientPTR[0], 0, 0, 0, 0, 0, 0);
+  for ( index = 0; index < DSP_BIQUAD_STATES; index++) {
+    accumulator = __builtin_mac(accumulator, statePTR[index],
+            coefficientPTR[index + 1], 0, 0, 0, 0, 0, 0, 0, 0);
+  }
+  // Q14 coefficients, one more shift to the left
+  outputW = (int16_t) __builtin_sacr(accumulator, -1);
+#else
+  int64_t sumLL = (int32_t) input * coefficientPTR[0];
+
+  for ( index = 0; index < DSP_BIQUAD_STATES; index++) {
+    sumLL += (int32_t) statePTR[index] * coefficientPTR[index + 1];
+  }
+  outputW = DSPSaturate((sumLL + 8192) >> 14);
+#endif
+
+  statePTR[1] = statePTR[0];
+  statePTR[0] = input;
+  statePTR[3] = statePTR[2];
+  statePTR[2] = outputW;
+
+  return outputW;
+}
+
+
+/*
+================================================================================
+Method name:  DSPPIDStep
+
+Originator:
+
+Description:
+  The purpose of this function is to return the output of a PID step, the sum
+  of the products of the fixed point gains and the terms (error, integral,
+  rate etc.). A gain of 0 leaves its term out. The sum is 64 bits, in the fixed
+  point of the gains, so the caller saturates it to the output range. The
+  products are made by DSPMultiply32() and not by MAC, the 32 bit gains and
+  terms do not fit its 16 bit operands.
+
+  This method should be called using DSPPIDStep().
+
+Resources:
+  None
+================================================================================
+ History:
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+static inline int64_t DSPPIDStep(const int32_t *gainPTR, const int32_t *termPTR,
+        uint8_t count)
+{
+  int64_t sumLL = 0;
+  uint8_t index;
+
+  for ( index = 0; index < count; index++) {
+    if ( gainPTR[index] != 0) {
+      sumLL += DSPMultiply32(gainPTR[index], termPTR[index]);
+    }
+  }
+
+  return sumLL;
+}
+
+#endif /*_DSPKERNEL_H_*/
@@ -43,6 +43,9 @@ IoTranslate requirements:
                    changes.
 2.2.0  07-16-2020  New enum & error code is added for       Poorana kumar G
                    temperature mode error.
+2.6.0  10-16-2026  New enum & error code is added for
+                   task watchdog error.
+2.6.0  10-16-2026  Task watchdog error has its own code.
 --------------------------------------------------------------------------------
 */
 
@@ -86,7 +89,8 @@ typedef enum {
   IO_TEST_ERROR,
   EEPROM_CRC_TEST_ERROR,
   BUTTON_MALFUNCTION_ERROR,
-  TEMPERATURE_MODE_ERROR
+  TEMPERATURE_MODE_ERROR,
+  TASK_WATCHDOG_ERROR
 }Errors_ETYP;
 
 //CLASS OBJECT DEFINITION
@@ -159,6 +163,7 @@ typedef struct {
 #define ERROR_CODE_EEPROM_CRC_TEST          6
 #define ERROR_CODE_BUTTON_MALFUNCTION       8
 #define ERROR_CODE_TEMPERATURE_MODE         6
+#define ERROR_CODE_TASK_WATCHDOG            7
 
 //  CLASS METHOD PROTOTYPES
 bool BuzzerLEDControl(void);
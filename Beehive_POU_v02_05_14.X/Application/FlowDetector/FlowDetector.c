@@ -45,6 +45,61 @@ IoTranslate requirements:
 
 Errors_ETYP prevResult;
 
+/*
+================================================================================
+Method name:    FlowDetectorSample
+                    
+Originator:   
+
+Description: 
+  Call every 1 msec to monitor the GPIO status change of Flow detector GPIO and
+  count the no. of toggles. At the end of each 1 sec window the toggles count
+  and the flow detector connection GPIO status are latched for FlowDetector().
+  Only the members outside the flags are written here, since this may run in
+  the Timer ISR.
+
+  This method should be called using FlowDetectorSample().
+
+Resources:
+  2 GPIOs which are connected with flow detector pulse & connection
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write, moved from FlowDetector
+--------------------------------------------------------------------------------
+*/
+
+void FlowDetectorSample(void)
+{
+  // Variable to store the current status of flow detector GPIO
+  uint8_t gpioCurrentStatus = 0;
+
+  // Read the current status of the flow detector GPIO
+  gpioCurrentStatus = FlowDetectorPulseDigIn_Read();
+
+  // Check with previous status
+  if ( gpioCurrentStatus != flowDetector.pulsePrevState) {
+      // If status change detected, store it & increment the toggles count
+      flowDetector.pulsePrevState = gpioCurrentStatus;
+      flowDetector.togglesW++;
+  }
+
+  // Decrement the flow detection timer
+  if( --flowDetector.flowDetectorTimerW == 0) {
+    // Reload the timer after it reaches 0
+    flowDetector.flowDetectorTimerW = FLOW_DETECTOR_TIMER;
+
+    // Latch the window for the flow detection
+    flowDetector.windowTogglesW = flowDetector.togglesW;
+    flowDetector.windowConnStatus = FlowDetectorConnDigIn_Read();
+    flowDetector.windowReady = 1;
+
+    // Reset the toggles count
+    flowDetector.togglesW = 0;
+  }
+}
+
+
 /*
 ================================================================================
 Method name:    FlowDetector
@@ -56,6 +111,9 @@ Description:
   of Flow detector GPIO and count the no. of toggles. And if minimum toggles for
   water flow is found, it will set flow detection bit.
 
+  When SCHEDULER_ISR_LANE is defined, the toggles are counted in the Timer ISR
+  and this function only checks the latched 1 sec window.
+
   This method should be called using flowDetector.Detect() method.
 
 Resources:
@@ -68,33 +126,26 @@ Resources:
 1.1.0  02-04-2020  As per the Beta requirement changes flow Poorana kumar G
                    detector connection check GPIO polling
                    and error report is added.
+2.6.0  10-16-2026  Toggles are counted in FlowDetectorSample
+                   and checked here once per window.
 --------------------------------------------------------------------------------
 */
 
 bool FlowDetector(void)
 {
-  // Variable to store the toggles
-  static uint16_t flowDetectorTogglesW = 0;
   // Variable to store the current status of flow detector GPIO
   bool gpioCurrentStatus = false;
 
-  // Read the current status of the flow detector GPIO
-  gpioCurrentStatus = FlowDetectorPulseDigIn_Read();
-
-  // Check with previous status
-  if ( gpioCurrentStatus != flowDetector.flags.flowPulsePrevStateFLG) {
-      // If status change detected, store it & increment the toggles count
-      flowDetector.flags.flowPulsePrevStateFLG = gpioCurrentStatus;
-      flowDetectorTogglesW++;
-  }
+#ifndef SCHEDULER_ISR_LANE
+  FlowDetectorSample();
+#endif
 
-  // Decrement the flow detection timer
-  if( --flowDetector.flowDetectorTimerW == 0) {
-    // Reload the timer after it reaches 0
-    flowDetector.flowDetectorTimerW = FLOW_DETECTOR_TIMER;
+  // Check the window of 1 sec is latched
+  if ( flowDetector.windowReady) {
+    flowDetector.windowReady = 0;
 
-    // Read the current status of the flow detector connection GPIO
-    gpioCurrentStatus = FlowDetectorConnDigIn_Read();
+    // Read the latched status of the flow detector connection GPIO
+    gpioCurrentStatus = flowDetector.windowConnStatus;
 
     // If previous status and current status both are high report the error
     if ( (gpioCurrentStatus) && (flowDetector.flags.flowDetectorConnPrevStateFLG)) {
@@ -105,7 +156,7 @@ bool FlowDetector(void)
       faultIndication.Clear(FLOW_SENSOR_ERROR);
 
       // Check GPIO toggles count with minimum toggles and decide flow detection
-      if (flowDetectorTogglesW >= MINIMUM_TOGGLES_FOR_WATER_FLOW) {
+      if (flowDetector.windowTogglesW >= MINIMUM_TOGGLES_FOR_WATER_FLOW) {
         flowDetector.flags.flowDetectedFLG = true;
       }
       else {
@@ -115,15 +166,13 @@ bool FlowDetector(void)
 
  
     // Convert the flow toggles per second to get frequency
-    update_flowIn_Gallons(flowDetectorTogglesW);
+    update_flowIn_Gallons(flowDetector.windowTogglesW);
     
     // Backup the connection GPIO status
     flowDetector.flags.flowDetectorConnPrevStateFLG = gpioCurrentStatus;
-
-    // Reset the toggles count
-    flowDetectorTogglesW = 0;
   }
 
+
   return TASK_COMPLETED;
 }
 
@@ -20,8 +20,14 @@ Class Methods:
     change of Flow detector GPIO and count the no. of toggles. And if minimum
     toggles for water flow is found, it will set flow detection bit.
 
+  void FlowDetectorSample(void);
+    Called every 1 msec to count the toggles of the flow detector GPIO and to
+    latch the count of each 1 sec window for FlowDetector().
+
 Method Calling Requirements:
   flowDetector.Detect() must be called 1 msec once in scheduler.
+  When SCHEDULER_ISR_LANE is defined, FlowDetectorSample() is called from the
+  Timer ISR every 1 msec and flowDetector.Detect() may be called less often.
 
 Resources:
   2 GPIOs which are connected with flow detector pulse & connection
@@ -37,6 +43,8 @@ IoTranslate requirements:
        09-23-2019  Initial Write                        Poorana kumar G
 1.1.0  02-04-2020  As per the Beta requirement changes  Poorana kumar G
                    updated the functions
+2.6.0  10-16-2026  GPIO sampling is split from the flow
+                   detection to run in the Timer ISR.
 --------------------------------------------------------------------------------
 */
 
@@ -55,8 +63,6 @@ typedef struct {
   struct {
     // Flow detection flag 0-No Flow 1-Flow
     uint8_t flowDetectedFLG:1;
-    // Flow Pulse GPIO status backup 0 - Low 1 - High
-    uint8_t flowPulsePrevStateFLG:1;
     // Flow Detector connection GPIO status backup 0 - Low 1 - High
     uint8_t flowDetectorConnPrevStateFLG:1;
   } flags;
@@ -72,11 +78,21 @@ typedef struct {
   float flowInGallons;
   float currentFlow;
   float prevFlow;
+  // Written by FlowDetectorSample(), kept out of the flags as it may run in ISR
+  // Flow Pulse GPIO status backup 0 - Low 1 - High
+  uint8_t pulsePrevState;
+  // Toggles counted in the current 1 sec window
+  uint16_t togglesW;
+  // Toggles and connection GPIO status latched at the end of the 1 sec window
+  volatile uint16_t windowTogglesW;
+  volatile uint8_t windowConnStatus;
+  // Set when a new window is latched, cleared by FlowDetector()
+  volatile uint8_t windowReady;
 } FlowDetector_STYP;
 
 
 // DEFINE CLASS OBJECT DEFAULTS
-#define FLOW_DETECTOR_DEFAULTS {{0,0,0},                    \
+#define FLOW_DETECTOR_DEFAULTS {{0,0},                      \
                                 &FlowDetector,              \
                                 &update_flowIn_Gallons,     \
                                 FLOW_DETECTOR_TIMER,        \
@@ -92,6 +108,8 @@ typedef struct {
 // CLASS METHOD PROTOTYPES
 bool FlowDetector(void);
 
+void FlowDetectorSample(void);
+
 float Get_flowIn_Gallons(void);
 
 void update_flowIn_Gallons(int pulseval);
@@ -39,6 +39,7 @@ IoTranslate requirements:
                    mode
        11-04-2019  PC-Lint warning is cleared.          Poorana kumar G
 2.3.0  09-14-2020  Code flash CRC is added in NVM.          Poorana kumar G
+2.6.0  10-16-2026  ADC calibration is added in NVM.
 --------------------------------------------------------------------------------
 */
 
@@ -97,6 +98,7 @@ Resources:
        11-04-2019  PC-Lint warning is cleared by            Poorana kumar G
                    initializing "lastCodeLocation" variable
 2.3.0  09-14-2020  Code flash CRC is added in NVM.          Poorana kumar G
+2.6.0  10-16-2026  ADC calibration is initialized.
 --------------------------------------------------------------------------------
 */
 void NonVol_Init(void)
@@ -132,6 +134,10 @@ void NonVol_Init(void)
     PID_CONST_HI_ERR_THRESH = INITIAL_HI_ERR_THRESH;
     PID_CONST_PREBURN_LIMIT = INITIAL_PREBURN_LIMIT;
 
+    // No ADC correction till the self calibration
+    nonVol.settings.adcOffset = 0;
+    nonVol.settings.adcGainTrim = 0;
+
     nonVol.write();
   }
   else {
@@ -39,6 +39,8 @@ IoTranslate requirements:
 2.3.0  09-14-2020  Code flash CRC is added in NVM.          Poorana kumar G
 2.3.2  05-11-2021  PID constant changes as per the          Dnyaneshwar
                    constant provided from Mike
+2.6.0  10-16-2026  ADC offset & gain trim are stored in the
+                   reserved word.
 --------------------------------------------------------------------------------
 */
 
@@ -69,7 +71,10 @@ typedef struct {
   uint8_t firstCriticalError;
   // Code Flash CRC
   uint16_t codeFlashCRCW;
-  uint16_t reserved;
+  // ADC self calibration, offset in ADC counts and gain trim in 1/4096 steps.
+  // These take the reserved word, so the settings stored before are valid.
+  int8_t adcOffset;
+  int8_t adcGainTrim;
   // PID constants configured through UART
   float pidConstantsARYF[6];                           
   // CRC for the setting
@@ -104,6 +109,7 @@ typedef struct {
     0,                              \
     0,                              \
     0,                              \
+    0,                              \
     {0,0,0,0,0,0},                  \
     0                               \
   },                                \
@@ -70,6 +70,9 @@ Description:
   Whenever AC line cross is detected,  this function will modulate the opto
   coupler as per the relay control state and power cycle calculated.
 
+  When SCHEDULER_ISR_LANE is defined, it is called from the Timer ISR in the
+  same tick the msAfterLCFLG is set, so the flags are written only in the ISR.
+
   This method should be called using optoCouplerControl.Modulate().
 
 Resources:
@@ -80,6 +83,7 @@ Resources:
  History:	
 -*-----*-----------*------------------------------------*-----------------------
        09-24-2019  Initial Write                        Poorana kumar G
+2.6.0  10-16-2026  Called from the Timer ISR lane.
 --------------------------------------------------------------------------------
 */
 
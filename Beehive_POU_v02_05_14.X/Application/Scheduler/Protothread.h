@@ -0,0 +1,104 @@
+/*
+================================================================================
+File name:    Protothread.h
+
+Originator:
+
+Platform:     dsPIC33EV64GM006
+Compiler:     XC16 V1.40
+IDE     :     MPLAB X IDE V5.20
+
+Description:
+  Stackless resumable tasks for the scheduler. A long job can be written as a
+  straight sequence of steps inside one scheduled task and split over the ticks
+  with PT_YIELD(), PT_WAIT_UNTIL() and PT_WAIT_TICKS(). Each of these returns
+  TASK_NOT_COMPLETED, so the scheduler calls the task again on the next tick
+  and the task resumes after the point it left. PT_END() returns TASK_COMPLETED
+  and the task starts again from PT_BEGIN() on its next interval.
+
+  The resume point is a line number used as a case label inside a switch, so
+  local variables are not kept across PT_YIELD(), PT_WAIT_UNTIL() and
+  PT_WAIT_TICKS(). Keep such values in the object or in static variables, and
+  do not use a switch statement around these macros.
+
+  Example:
+    bool Task(void)
+    {
+      PT_BEGIN(&object.taskPT);
+      StartJob();
+      PT_WAIT_UNTIL(&object.taskPT, JobDone());
+      PT_WAIT_TICKS(&object.taskPT, 10);
+      FinishJob();
+      PT_END(&object.taskPT);
+    }
+
+Class Methods:
+  None
+
+Resources:
+  None
+================================================================================
+ History:
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+
+#ifndef _PROTOTHREAD_H_
+#define _PROTOTHREAD_H_
+
+#include "Build.h"
+#include "Scheduler.h"
+
+// State of a resumable task
+typedef struct {
+  // Line number to resume from, 0 to start from PT_BEGIN()
+  uint16_t resumeLine;
+  // Tick count at the start of PT_WAIT_TICKS()
+  uint16_t startTickW;
+} Protothread_STYP;
+
+#define PROTOTHREAD_DEFAULTS    { 0, 0 }
+
+// Restart the task from PT_BEGIN() on its next call
+#define PT_INIT(pt)             ((pt)->resumeLine = 0)
+
+// Start of the resumable task body
+#define PT_BEGIN(pt)            switch ( (pt)->resumeLine) { case 0:
+
+// End of the resumable task body, the task is completed
+#define PT_END(pt)                                                            \
+          default:                                                            \
+          break;                                                              \
+        }                                                                     \
+        (pt)->resumeLine = 0;                                                 \
+        return TASK_COMPLETED
+
+// Give up the CPU till the next tick
+#define PT_YIELD(pt)                                                          \
+  do {                                                                        \
+    (pt)->resumeLine = __LINE__;                                              \
+    return TASK_NOT_COMPLETED;                                                \
+    case __LINE__:;                                                           \
+  } while ( 0)
+
+// Check the condition once per tick and continue when it is true
+#define PT_WAIT_UNTIL(pt, condition)                                          \
+  do {                                                                        \
+    (pt)->resumeLine = __LINE__;                                              \
+    case __LINE__:                                                            \
+    if ( !(condition)) {                                                      \
+      return TASK_NOT_COMPLETED;                                              \
+    }                                                                         \
+  } while ( 0)
+
+// Continue after the given number of 1 ms ticks
+#define PT_WAIT_TICKS(pt, ticks)                                              \
+  do {                                                                        \
+    (pt)->startTickW = scheduler.tickCountW;                                  \
+    PT_WAIT_UNTIL((pt), ((uint16_t)(scheduler.tickCountW - (pt)->startTickW) \
+            >= (uint16_t)(ticks)));                                           \
+  } while ( 0)
+
+#endif /*_PROTOTHREAD_H_*/
@@ -13,35 +13,854 @@ Description:
   to run the scheduler.   It calls all the time based functions and handles all
   fault and events generated in class level objects.
 
-  Whenever interrupt occurs it will down count the counter for each task and
-  when it expired, scheduler execute the task and reloads the counter.
+  The tasks are kept in a delta queue sorted by their next due tick. Each entry
+  holds the ticks remaining after the entry in front of it, so on every tick
+  only the head counter is down counted and only the tasks which are due (or
+  still returning TASK_NOT_COMPLETED) are touched.
+
+  When SCHEDULER_PROFILE is defined, each task call is timed from the tick count
+  and the TMR1 counter and the result is added to the profile of the task. The
+  delay from the start of the due tick to the task start is kept as lateness.
+
+  When SCHEDULER_TICKLESS_IDLE is defined, the CPU is kept in Idle mode till a
+  task is due, counting down the ticks in between.
+
+  When SCHEDULER_STATIC_TASKS is defined, the tasks and their intervals are
+  taken from the constant task table and the tasks are called directly.
+
+  When SCHEDULER_ISR_LANE is defined, the ISR lane tasks are called from the
+  Timer ISR and their execution time is checked against the budget.
+
+  When SCHEDULER_LOAD_SHEDDING is defined, continuous over runs stretch the non
+  critical tasks level by level before OVER_RUN_ERROR is reported.
+
+  When SCHEDULER_EVENT_TRIGGER is defined, the tasks waiting for an event are
+  released when the event is signalled and their maximum interval timer is
+  restarted.
 
 Class Methods:
   void Scheduler_run(void);
     Execute the tasks scheduled whenever timer interrupt occurs
 
-  int32_t Scheduler_add_task(void (*Taskptr)(void), uint16_t initialDelayW,
-  uint16_t TimeW);
-    To add the task in the scheduler 
+  int32_t Scheduler_add_task(void (*Taskptr)(void), uint16_t initialDelayW,
+  uint16_t TimeW, uint8_t shedLevel);
+    To add the task in the scheduler 
+
+  void Scheduler_reset_profile(void);
+    To clear the execution time measured for all the tasks
+
+  void Scheduler_idle(void);
+    To keep the CPU in Idle mode till a task is due
+
+  void Scheduler_init(void);
+    To queue the tasks of the compile time task table
+
+  void Scheduler_run_isr_lane(void);
+    To execute the ISR lane tasks from the Timer ISR
+
+  int32_t Scheduler_add_event_task(bool (*Taskptr)(void), uint16_t initialDelayW,
+  uint16_t maxTimeW, uint8_t shedLevel, uint8_t eventId);
+    To add the task released on the event or after the maximum interval
+
+  void Scheduler_signal_event(uint8_t eventId);
+    To release the tasks waiting for the event
+
+  void Scheduler_check_watchdog_reset(void);
+    To report the task which caused the watchdog reset
+
+Resources:
+  None
+
+IoTranslate requirements:
+  #define SCHEDULER_TIMER_COUNT()       // Read the 1 ms tick timer counter
+  #define SCHEDULER_TIMER_TICK_COUNTS   // Timer counts in one tick
+  #define SCHEDULER_CPU_IDLE()          // Enter the CPU Idle mode
+  #define SCHEDULER_MASK_INTERRUPTS()   // Mask the interrupts
+  #define SCHEDULER_UNMASK_INTERRUPTS() // Restore the interrupt level
+  #define SCHEDULER_WATCHDOG_RESET()    // Watchdog time out reset flag
+  #define SCHEDULER_WATCHDOG_RESET_CLEAR() // Clear the time out reset flag
+  #define SCHEDULER_PERSISTENT          // Variable not cleared on reset
+
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+       09-23-2019  Initial Write                        Poorana kumar G
+2.6.0  10-16-2026  Per task down counters are replaced
+                   with a delta queue.
+2.6.0  10-16-2026  Task execution time profile is added.
+2.6.0  10-16-2026  Tickless Idle method is added.
+2.6.0  10-16-2026  Compile time task table is added.
+2.6.0  10-16-2026  ISR lane for the 1 ms critical tasks.
+2.6.0  10-16-2026  Task release lateness is measured.
+2.6.0  10-16-2026  Load shedding levels are added.
+2.6.0  10-16-2026  Event triggered tasks are added.
+2.6.0  10-16-2026  Task watchdog check in is added.
+2.6.0  10-16-2026  Watchdog task is kept over the reset.
+2.6.0  10-16-2026  Lateness after the lost ticks is kept.
+2.6.0  10-16-2026  Watchdog error is cleared when the task
+                   recovers.
+--------------------------------------------------------------------------------
+*/
+
+
+#include "Scheduler.h"
+#include "IoTranslate.h"
+#include "FaultIndication.h"
+#include "SelfTest.h"
+
+#ifdef SCHEDULER_ISR_LANE
+#include "OptoCouplerControl.h"
+#include "FlowDetector.h"
+
+// Budget of each ISR lane task in flash
+#define SCHEDULER_ISR_TASK_BUDGET(function, budget)     (budget),
+
+static const uint16_t schedulerISRBudgetARYW[SCHEDULER_ISR_LANE_TASKS] = {
+  SCHEDULER_ISR_LANE_TABLE(SCHEDULER_ISR_TASK_BUDGET)
+};
+
+// Direct call of each ISR lane task
+#define SCHEDULER_ISR_TASK_CALL(function, budget)                           \
+  case SCHEDULER_ISR_TASK_##function:                                       \
+    (void) function();                                                      \
+  break;
+
+
+/*
+================================================================================
+Method name:    Scheduler_run_isr_lane
+                    
+Originator:   
+
+Description: 
+  Called from the Timer ISR every 1 ms after the AC line cross sampling. Each
+  task of the ISR lane table is called directly and its execution time is
+  measured with the TMR1 counter. When a task runs longer than its budget, the
+  over run is counted and if it continues for MAX_OVERRUNS ticks the over run
+  flag is latched. The fault list is not protected from the interrupts, so
+  OVER_RUN_ERROR is reported by Scheduler_run() from the background lane. The
+  background tasks do not delay these tasks.
+
+  This method should be called using scheduler.RunISRLane() method.
+
+Resources:
+  TMR1
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+2.6.0  10-16-2026  Over run is latched for the
+                   background lane to report.
+--------------------------------------------------------------------------------
+*/
+
+void Scheduler_run_isr_lane(void)
+{
+  SchedulerISRLane_STYP *isrLane = 0;
+  uint8_t laneIndex = 0;
+  uint16_t startCountW = 0;
+  uint16_t endCountW = 0;
+  uint16_t elapsedW = 0;
+
+  for ( laneIndex = 0; laneIndex < SCHEDULER_ISR_LANE_TASKS; laneIndex++) {
+    isrLane = &scheduler.isrLane[laneIndex];
+
+    // Counter starts from 0 at the tick, so it is the lateness of the task
+    startCountW = SCHEDULER_TIMER_COUNT();
+    if ( startCountW > isrLane->latenessMaxW) {
+      isrLane->latenessMaxW = startCountW;
+    }
+
+    switch ( laneIndex) {
+      SCHEDULER_ISR_LANE_TABLE(SCHEDULER_ISR_TASK_CALL)
+      default:
+      break;
+    }
+
+    // Find the execution time, the counter may roll over once
+    endCountW = SCHEDULER_TIMER_COUNT();
+    elapsedW = endCountW - startCountW;
+    if ( endCountW < startCountW) {
+      elapsedW += SCHEDULER_TIMER_TICK_COUNTS;
+    }
+
+    if ( elapsedW > isrLane->maxW) {
+      isrLane->maxW = elapsedW;
+    }
+
+    // Check the budget of the task
+    if ( elapsedW > schedulerISRBudgetARYW[laneIndex]) {
+      if ( isrLane->overRunsW != 0xFFFF) {
+        isrLane->overRunsW++;
+      }
+
+      if ( ++isrLane->overRunCounter > MAX_OVERRUNS) {
+        isrLane->overRunCounter = MAX_OVERRUNS;
+        scheduler.isrOverRunFLG = true;
+      }
+    }
+    else {
+      isrLane->overRunCounter = 0;
+    }
+  }
+}
+#endif
+
+#ifdef SCHEDULER_STATIC_TASKS
+#include "OptoCouplerControl.h"
+#include "UserInterface.h"
+#include "FlowDetector.h"
+#include "ADCRead.h"
+#include "ModeCheck.h"
+#include "TemperatureControl.h"
+#ifdef DEBUG_MACRO
+#include "SerialDebug.h"
+#endif
+
+// Task table must fit in the task bit masks
+typedef char SchedulerTaskCountCheck_TYP[                                   \
+        ((SCHEDULER_STATIC_TASK_COUNT <= SCHEDULER_MAX_TASKS) &&            \
+        (SCHEDULER_STATIC_TASK_COUNT <= 16)) ? 1 : -1];
+
+// Interval of the slow tasks must be in multiple of SCHEDULER_PHASE_PERIOD
+#define SCHEDULER_TASK_INTERVAL_CHECK(function, initialDelay, interval, shedLevel) \
+  typedef char SchedulerIntervalCheck_##function##_TYP[                     \
+        (((interval) < SCHEDULER_PHASE_PERIOD) ||                           \
+        (((interval) % SCHEDULER_PHASE_PERIOD) == 0)) ? 1 : -1];
+
+SCHEDULER_TASK_TABLE(SCHEDULER_TASK_INTERVAL_CHECK)
+
+// Slow tasks with the same phase give the duplicate case value compile error.
+// Fast tasks are given a unique value above the phase period.
+#define SCHEDULER_TASK_PHASE_CHECK(function, initialDelay, interval, shedLevel) \
+  case (((interval) < SCHEDULER_PHASE_PERIOD) ?                             \
+          (SCHEDULER_PHASE_PERIOD + SCHEDULER_TASK_##function) :            \
+          ((initialDelay) % SCHEDULER_PHASE_PERIOD)) :                      \
+  break;
+
+static inline void SchedulerTaskPhaseCheck(uint16_t phaseW)
+{
+  switch ( phaseW) {
+    SCHEDULER_TASK_TABLE(SCHEDULER_TASK_PHASE_CHECK)
+    default:
+    break;
+  }
+}
+
+// Interval of each task stored in flash, same as scheduledTimeW
+#define SCHEDULER_TASK_TIMING(function, initialDelay, interval, shedLevel)  \
+  { (initialDelay), ((interval) - 1), (shedLevel) },
+
+static const struct {
+  uint16_t initialDelayW;
+  uint16_t scheduledTimeW;
+  uint8_t shedLevel;
+} schedulerTaskTableARY[SCHEDULER_STATIC_TASK_COUNT] = {
+  SCHEDULER_TASK_TABLE(SCHEDULER_TASK_TIMING)
+};
+
+// Direct call of each task
+#define SCHEDULER_TASK_CALL(function, initialDelay, interval, shedLevel)    \
+  case SCHEDULER_TASK_##function:                                           \
+    taskStatus = function();                                                \
+  break;
+
+/*
+================================================================================
+Method name:    SchedulerCallTask
+                    
+Originator:   
+
+Description: 
+  Call the task of the task table directly, so the compiler can avoid the
+  indirect call through the function pointer.
+
+  This method should be called using SchedulerCallTask().
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+static inline bool SchedulerCallTask(uint8_t taskIndex)
+{
+  bool taskStatus = TASK_COMPLETED;
+
+  switch ( taskIndex) {
+    SCHEDULER_TASK_TABLE(SCHEDULER_TASK_CALL)
+    default:
+    break;
+  }
+
+  return taskStatus;
+}
+
+#define SCHEDULER_TASK_INTERVAL(taskIndex)                                  \
+  schedulerTaskTableARY[taskIndex].scheduledTimeW
+#define SCHEDULER_CALL_TASK(taskIndex)      SchedulerCallTask(taskIndex)
+
+// Add the task of the event table in the waiting tasks of the event
+#define SCHEDULER_EVENT_SUBSCRIBE(event, function)                          \
+  scheduler.eventSubscribersARYW[event] |= (1u << SCHEDULER_TASK_##function);
+#else
+#define SCHEDULER_TASK_INTERVAL(taskIndex)                                  \
+  scheduler.scheduledTasks[taskIndex].scheduledTimeW
+#define SCHEDULER_CALL_TASK(taskIndex)                                      \
+  scheduler.scheduledTasks[taskIndex].Taskptr()
+#endif
+
+#ifdef SCHEDULER_EVENT_TRIGGER
+#define SCHEDULER_EVENT_TASKS()             scheduler.eventTasksW
+#else
+#define SCHEDULER_EVENT_TASKS()             0
+#endif
+
+
+#ifdef SCHEDULER_PROFILE
+/*
+================================================================================
+Method name:    SchedulerProfileTimeStamp
+                    
+Originator:   
+
+Description: 
+  Read the tick count and the TMR1 counter together. If the tick interrupt
+  occurs in between, both are read again.
+
+  This method should be called using SchedulerProfileTimeStamp().
+
+Resources:
+  TMR1
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+static void SchedulerProfileTimeStamp(uint16_t *tickW, uint16_t *countW)
+{
+  do {
+    *tickW = scheduler.tickCountW;
+    *countW = SCHEDULER_TIMER_COUNT();
+  } while ( *tickW != scheduler.tickCountW);
+}
+
+
+/*
+================================================================================
+Method name:    SchedulerProfileCounts
+                    
+Originator:   
+
+Description: 
+  Find the TMR1 counts between two time stamps. Times longer than 16 bit counts
+  are saturated.
+
+  This method should be called using SchedulerProfileCounts().
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write, moved from
+                   SchedulerProfileUpdate
+--------------------------------------------------------------------------------
+*/
+
+static uint16_t SchedulerProfileCounts(uint16_t startTickW,                 \
+        uint16_t startCountW, uint16_t endTickW, uint16_t endCountW)
+{
+  uint32_t elapsedL = 0;
+
+  elapsedL = ((uint32_t)(uint16_t)(endTickW - startTickW) *               \
+          SCHEDULER_TIMER_TICK_COUNTS) + endCountW - startCountW;
+
+  if ( elapsedL > 0xFFFF) {
+    elapsedL = 0xFFFF;
+  }
+
+  return (uint16_t) elapsedL;
+}
+
+
+/*
+================================================================================
+Method name:    SchedulerProfileBin
+                    
+Originator:   
+
+Description: 
+  Find the log2 histogram bin of the counts, which is the position of the
+  highest bit set. The last bin holds all the longer times.
+
+  This method should be called using SchedulerProfileBin().
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write, moved from
+                   SchedulerProfileUpdate
+--------------------------------------------------------------------------------
+*/
+
+static uint8_t SchedulerProfileBin(uint16_t countsW)
+{
+  uint8_t bin = 0;
+
+  for ( countsW >>= 1; (countsW != 0) &&                                  \
+          (bin < (SCHEDULER_PROFILE_BINS - 1)); countsW >>= 1) {
+    bin++;
+  }
+
+  return bin;
+}
+
+
+/*
+================================================================================
+Method name:    SchedulerLatenessUpdate
+                    
+Originator:   
+
+Description: 
+  Find how late the task is started from the start of the tick it was due and
+  add it to the worst lateness and the lateness histogram of the task. The due
+  tick is the releaseTickW of this scheduler run.
+
+  This method should be called using SchedulerLatenessUpdate().
+
+Resources:
+  TMR1
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+static void SchedulerLatenessUpdate(uint8_t taskIndex, uint16_t startTickW, \
+        uint16_t startCountW)
+{
+  SchedulerProfile_STYP *profile = &scheduler.profile[taskIndex];
+  uint16_t latenessW = 0;
+  uint8_t bin = 0;
+
+  latenessW = SchedulerProfileCounts(scheduler.releaseTickW, 0,             \
+          startTickW, startCountW);
+
+  if ( latenessW > profile->latenessMaxW) {
+    profile->latenessMaxW = latenessW;
+  }
+
+  bin = SchedulerProfileBin(latenessW);
+  if ( profile->latenessHistogramARYW[bin] != 0xFFFF) {
+    profile->latenessHistogramARYW[bin]++;
+  }
+}
+
+
+/*
+================================================================================
+Method name:    SchedulerProfileUpdate
+                    
+Originator:   
+
+Description: 
+  Find the time taken by the task from the time stamp taken before the call and
+  add it to the minimum, maximum, average and histogram of the task. Times
+  longer than 16 bit counts are saturated. When the execution count is about to
+  overflow, both the sum and the count are halved to keep the average.
+
+  This method should be called using SchedulerProfileUpdate().
+
+Resources:
+  TMR1
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+static void SchedulerProfileUpdate(uint8_t taskIndex, uint16_t startTickW,  \
+        uint16_t startCountW)
+{
+  SchedulerProfile_STYP *profile = &scheduler.profile[taskIndex];
+  uint16_t endTickW = 0;
+  uint16_t endCountW = 0;
+  uint16_t elapsedW = 0;
+  uint8_t bin = 0;
+
+  SchedulerProfileTimeStamp(&endTickW, &endCountW);
+
+  elapsedW = SchedulerProfileCounts(startTickW, startCountW, endTickW,      \
+          endCountW);
+
+  if ( (profile->countW == 0) || (elapsedW < profile->minW)) {
+    profile->minW = elapsedW;
+  }
+  if ( elapsedW > profile->maxW) {
+    profile->maxW = elapsedW;
+  }
+
+  if ( profile->countW == 0xFFFF) {
+    profile->countW >>= 1;
+    profile->sumL >>= 1;
+  }
+  profile->countW++;
+  profile->sumL += elapsedW;
+
+  bin = SchedulerProfileBin(elapsedW);
+  if ( profile->histogramARYW[bin] != 0xFFFF) {
+    profile->histogramARYW[bin]++;
+  }
+}
+
+
+/*
+================================================================================
+Method name:    Scheduler_reset_profile
+                    
+Originator:   
+
+Description: 
+  Clear the execution time and the lateness histogram measured for all the
+  tasks, including the longest time and the over runs of the ISR lane tasks.
+  The worst lateness is kept since power ON.
+
+  This method should be called using scheduler.ResetProfile() method.
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+void Scheduler_reset_profile(void)
+{
+  SchedulerProfile_STYP clearProfile = {0};
+  uint8_t Tasks_index = 0;
+
+  for ( Tasks_index = 0; Tasks_index < SCHEDULER_TASK_SLOTS; Tasks_index++) {
+    clearProfile.latenessMaxW = scheduler.profile[Tasks_index].latenessMaxW;
+    scheduler.profile[Tasks_index] = clearProfile;
+  }
+
+#ifdef SCHEDULER_ISR_LANE
+  for ( Tasks_index = 0; Tasks_index < SCHEDULER_ISR_LANE_TASKS; Tasks_index++) {
+    scheduler.isrLane[Tasks_index].maxW = 0;
+    scheduler.isrLane[Tasks_index].overRunsW = 0;
+  }
+#endif
+}
+#endif
+
+
+/*
+================================================================================
+Method name:    SchedulerQueueInsert
+                    
+Originator:   
+
+Description: 
+  Insert the task into the delta queue to become due after the given ticks.
+  The counter of the task is stored relative to the task in front of it and
+  the counter of the task behind it is reduced by the same amount. Tasks due on
+  the same tick are kept in the order they were added to the scheduler, so
+  they are executed in the same order as before.
+
+  This method should be called using SchedulerQueueInsert().
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+static void SchedulerQueueInsert(uint8_t taskIndex, uint16_t ticksW)
+{
+  uint8_t prevIndex = SCHEDULER_NO_TASK;
+  uint8_t nextIndex = scheduler.queueHead;
+
+  // Walk till the task which is due later than this task
+  while ( nextIndex != SCHEDULER_NO_TASK) {
+    if ( (ticksW < scheduler.scheduledTasks[nextIndex].counterW) ||     \
+            ((ticksW == scheduler.scheduledTasks[nextIndex].counterW) && \
+            (taskIndex < nextIndex))) {
+      break;
+    }
+
+    ticksW -= scheduler.scheduledTasks[nextIndex].counterW;
+    prevIndex = nextIndex;
+    nextIndex = scheduler.scheduledTasks[nextIndex].nextTask;
+  }
+
+  // Link the task in front of the next one and keep its due time unchanged
+  scheduler.scheduledTasks[taskIndex].counterW = ticksW;
+  scheduler.scheduledTasks[taskIndex].nextTask = nextIndex;
+
+  if ( nextIndex != SCHEDULER_NO_TASK) {
+    scheduler.scheduledTasks[nextIndex].counterW -= ticksW;
+  }
+
+  if ( prevIndex == SCHEDULER_NO_TASK) {
+    scheduler.queueHead = taskIndex;
+  }
+  else {
+    scheduler.scheduledTasks[prevIndex].nextTask = taskIndex;
+  }
+}
+
+
+#ifdef SCHEDULER_EVENT_TRIGGER
+/*
+================================================================================
+Method name:    SchedulerQueueRemove
+                    
+Originator:   
+
+Description: 
+  Remove the task from the delta queue. The ticks of the task are added to the
+  task behind it, so the due time of the other tasks is unchanged.
+
+  This method should be called using SchedulerQueueRemove().
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+static void SchedulerQueueRemove(uint8_t taskIndex)
+{
+  uint8_t prevIndex = SCHEDULER_NO_TASK;
+  uint8_t nextIndex = scheduler.queueHead;
+
+  // Walk till the task
+  while ( (nextIndex != SCHEDULER_NO_TASK) && (nextIndex != taskIndex)) {
+    prevIndex = nextIndex;
+    nextIndex = scheduler.scheduledTasks[nextIndex].nextTask;
+  }
+
+  if ( nextIndex == SCHEDULER_NO_TASK) {
+    return;
+  }
+
+  // Unlink the task and give its ticks to the task behind it
+  nextIndex = scheduler.scheduledTasks[taskIndex].nextTask;
+
+  if ( nextIndex != SCHEDULER_NO_TASK) {
+    scheduler.scheduledTasks[nextIndex].counterW +=                         \
+            scheduler.scheduledTasks[taskIndex].counterW;
+  }
+
+  if ( prevIndex == SCHEDULER_NO_TASK) {
+    scheduler.queueHead = nextIndex;
+  }
+  else {
+    scheduler.scheduledTasks[prevIndex].nextTask = nextIndex;
+  }
+}
+
+
+/*
+================================================================================
+Method name:    Scheduler_signal_event
+                    
+Originator:   
+
+Description: 
+  Release all the tasks waiting for the event. They are executed in the same
+  tick if they come after the calling task in the task order, otherwise in the
+  next tick. Tasks which are not yet released by their initial delay ignore the
+  event. This method is called from the tasks, not from the interrupts.
+
+  This method should be called using scheduler.SignalEvent() method.
 
 Resources:
   None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
 
-IoTranslate requirements:
+void Scheduler_signal_event(uint8_t eventId)
+{
+  if ( eventId < SCHEDULER_EVENTS) {
+    scheduler.eventTasksW |= (scheduler.eventSubscribersARYW[eventId] &     \
+            scheduler.startedTasksW);
+  }
+}
+#endif
+
+
+#ifdef SCHEDULER_LOAD_SHEDDING
+/*
+================================================================================
+Method name:    SchedulerShedRegister
+                    
+Originator:   
+
+Description: 
+  Add the task in the stretched task mask of its shedding level and of all the
+  higher levels. Tasks added with SCHEDULER_SHED_NONE are never stretched.
+
+  This method should be called using SchedulerShedRegister().
+
+Resources:
   None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+static void SchedulerShedRegister(uint8_t taskIndex, uint8_t shedLevel)
+{
+  if ( shedLevel == SCHEDULER_SHED_NONE) {
+    return;
+  }
+
+  for ( ; shedLevel < SCHEDULER_SHED_LEVELS; shedLevel++) {
+    scheduler.shedTasksARYW[shedLevel] |= (1u << taskIndex);
+  }
+}
 
+
+/*
+================================================================================
+Method name:    SchedulerLoadShed
+                    
+Originator:   
+
+Description: 
+  Called at the end of every scheduler run. When the over runs continue for
+  MAX_OVERRUNS ticks, the shedding level is stepped up and the over run count
+  starts again. If the over runs continue at the last level, the critical tasks
+  are missing their tick and OVER_RUN_ERROR is reported. After
+  SCHEDULER_SHED_RECOVERY_TICKS ticks without over run, the shedding level is
+  stepped down.
+
+  This method should be called using SchedulerLoadShed().
+
+Resources:
+  None
 ================================================================================
  History:	
 -*-----*-----------*------------------------------------*-----------------------
-       09-23-2019  Initial Write                        Poorana kumar G
+2.6.0  10-16-2026  Initial Write
 --------------------------------------------------------------------------------
 */
 
+static void SchedulerLoadShed(bool overRunFLG)
+{
+  if ( overRunFLG) {
+    scheduler.shedRecoveryW = 0;
 
-#include "Scheduler.h"
-#include "FaultIndication.h"
-#include "SelfTest.h"
+    if ( scheduler.overRunCounter > MAX_OVERRUNS) {
+      if ( scheduler.shedLevel < (SCHEDULER_SHED_LEVELS - 1)) {
+        scheduler.shedLevel++;
+        scheduler.overRunCounter = 0;
+        if ( scheduler.shed[scheduler.shedLevel].entriesW != 0xFFFF) {
+          scheduler.shed[scheduler.shedLevel].entriesW++;
+        }
+      }
+      else {
+        faultIndication.Error(OVER_RUN_ERROR);
+      }
+    }
+  }
+  else if ( scheduler.shedLevel != SCHEDULER_SHED_NONE) {
+    scheduler.shedRecoveryW++;
+
+    if ( scheduler.shedRecoveryW >= SCHEDULER_SHED_RECOVERY_TICKS) {
+      scheduler.shedRecoveryW = 0;
+      scheduler.shedLevel--;
+
+      // Tasks not stretched any more must not skip their next call
+      scheduler.shedSkipTasksW &= scheduler.shedTasksARYW[scheduler.shedLevel];
+    }
+  }
+}
+#endif
+
+
+#ifdef SCHEDULER_STATIC_TASKS
+/*
+================================================================================
+Method name:    Scheduler_init
+                    
+Originator:   
+
+Description: 
+  Queue all the tasks of the compile time task table to become due after their
+  initial delay. This replaces the scheduler.AddTask() calls at power ON.
+
+  This method should be called using scheduler.Init() method.
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+void Scheduler_init(void)
+{
+  uint8_t Tasks_index = 0;
+
+  for ( Tasks_index = 0; Tasks_index < SCHEDULER_STATIC_TASK_COUNT; Tasks_index++) {
+    SchedulerQueueInsert(Tasks_index,                                       \
+            schedulerTaskTableARY[Tasks_index].initialDelayW);
+#ifdef SCHEDULER_LOAD_SHEDDING
+    SchedulerShedRegister(Tasks_index,                                      \
+            schedulerTaskTableARY[Tasks_index].shedLevel);
+#endif
+  }
+
+#ifdef SCHEDULER_EVENT_TRIGGER
+  // Tasks waiting for the events
+  SCHEDULER_EVENT_TABLE(SCHEDULER_EVENT_SUBSCRIBE)
+#endif
+
+#ifdef SCHEDULER_TASK_WATCHDOG
+  // Watchdog window of each task starts from its first release
+  for ( Tasks_index = 0; Tasks_index < SCHEDULER_STATIC_TASK_COUNT; Tasks_index++) {
+    scheduler.checkInTickARYW[Tasks_index] = scheduler.tickCountW +        \
+            schedulerTaskTableARY[Tasks_index].initialDelayW;
+  }
+#endif
 
+  scheduler.noOfTasks = SCHEDULER_STATIC_TASK_COUNT;
+
+#ifdef SCHEDULER_PROFILE
+  // First run serves the next tick
+  scheduler.releaseTickW = scheduler.tickCountW;
+#endif
+}
+#else
 /*
 ================================================================================
 Method name:    Scheduler_add_task
@@ -53,7 +872,9 @@ Description:
   receive the pointer of the function which have the task to be executed and the
   time to execute the task. The function pointer and the time interval are
   stored to the task array and the number of tasks are increased. If it unable
-  to add the task, this function will return -1.
+  to add the task, this function will return -1. The shedding level is the
+  level from which the task is stretched to half rate under overload, critical
+  tasks are added with SCHEDULER_SHED_NONE.
 
   This method should be called using scheduler.AddTask() method.
 
@@ -63,18 +884,37 @@ Resources:
  History:	
 -*-----*-----------*------------------------------------*-----------------------
        09-23-2019  Initial Write                        Poorana kumar G
+2.6.0  10-16-2026  Shedding level of the task is added.
 --------------------------------------------------------------------------------
 */
 
-int32_t Scheduler_add_task(bool (*Taskptr)(void), uint16_t initialDelayW, uint16_t TimeW)
+int32_t Scheduler_add_task(bool (*Taskptr)(void), uint16_t initialDelayW, uint16_t TimeW, uint8_t shedLevel)
 {
   if ( scheduler.noOfTasks < SCHEDULER_MAX_TASKS) {
     // Store the task in the scheduler
-    scheduler.scheduledTasks[scheduler.noOfTasks].counterW = initialDelayW;
     scheduler.scheduledTasks[scheduler.noOfTasks].scheduledTimeW = (TimeW - 1);
     scheduler.scheduledTasks[scheduler.noOfTasks].Taskptr = Taskptr;
     scheduler.scheduledTasks[scheduler.noOfTasks].taskStatus = TASK_COMPLETED;
 
+    // Queue the task to become due after the initial delay
+    SchedulerQueueInsert(scheduler.noOfTasks, initialDelayW);
+
+#ifdef SCHEDULER_LOAD_SHEDDING
+    SchedulerShedRegister(scheduler.noOfTasks, shedLevel);
+#else
+    (void) shedLevel;
+#endif
+
+#ifdef SCHEDULER_PROFILE
+    // First run serves the next tick
+    scheduler.releaseTickW = scheduler.tickCountW;
+#endif
+
+#ifdef SCHEDULER_TASK_WATCHDOG
+    // Watchdog window starts from the first release
+    scheduler.checkInTickARYW[scheduler.noOfTasks] = scheduler.tickCountW + initialDelayW;
+#endif
+
     // Increment the No.of tasks listed in the scheduler
     scheduler.noOfTasks++;
 
@@ -85,6 +925,47 @@ int32_t Scheduler_add_task(bool (*Taskptr)(void), uint16_t initialDelayW, uint16
   // Return Error
   return -1;
 }
+#endif
+
+#if (defined SCHEDULER_EVENT_TRIGGER) && !(defined SCHEDULER_STATIC_TASKS)
+/*
+================================================================================
+Method name:    Scheduler_add_event_task
+                    
+Originator:   
+
+Description: 
+  Add the task to the scheduler like scheduler.AddTask() and make it wait for
+  the event. The task is released when the event is signalled, or after the
+  maximum interval from its last release if the event does not come. If it is
+  unable to add the task, this function will return -1.
+
+  This method should be called using scheduler.AddEventTask() method.
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+int32_t Scheduler_add_event_task(bool (*Taskptr)(void), uint16_t initialDelayW, uint16_t maxTimeW, uint8_t shedLevel, uint8_t eventId)
+{
+  if ( (eventId >= SCHEDULER_EVENTS) ||                                     \
+          (Scheduler_add_task(Taskptr, initialDelayW, maxTimeW, shedLevel) != 0)) {
+    // Return Error
+    return -1;
+  }
+
+  scheduler.eventSubscribersARYW[eventId] |= (1u << (scheduler.noOfTasks - 1));
+
+  // Return Success
+  return 0;
+}
+#endif
+
 
 /*
 ================================================================================
@@ -95,11 +976,15 @@ Originator:     Poorana kumar G
 Description: 
   Main Monitors the interruptFLG in Scheduler_STYP continuously. Whenever it
   found that bit as '1' i.e 1 ms tick occurs, it will call the Scheduler.run()
-  to execute the scheduled tasks. Scheduler have task pointer and the counter to
-  execute the task when it expires. For each ticks the counter gets decremented,
-  and when it reaches zero scheduler executes the task and reload the counter.
-  In this way it will execute all the tasks scheduled whenever tick is getting
-  triggered.
+  to execute the scheduled tasks. The tasks which are due are removed from the
+  head of the delta queue, the head counter is decremented for this tick and the
+  removed tasks are queued again with their interval. Then the due tasks and the
+  tasks still returning TASK_NOT_COMPLETED are executed in the order they were
+  added. In this way the tasks which are not due are never touched. Under load
+  shedding, the stretched tasks skip every other call. Tasks released by an
+  event are executed with them and queued again with their maximum interval.
+  A task returning TASK_COMPLETED checks in to the task watchdog. The over run
+  latched by the ISR lane is reported here, outside the interrupt.
 
   This method should be called using scheduler.run() method.
 
@@ -109,32 +994,134 @@ Resources:
  History:	
 -*-----*-----------*------------------------------------*-----------------------
        09-23-2019  Initial Write                        Poorana kumar G
+2.6.0  10-16-2026  Only the due and not completed tasks
+                   are executed from the delta queue.
+2.6.0  10-16-2026  Execution time of each task call is
+                   added to the task profile.
+2.6.0  10-16-2026  Tasks of the compile time task table
+                   are called directly.
+2.6.0  10-16-2026  Release lateness of the due tasks is
+                   added to the task profile.
+2.6.0  10-16-2026  Continuous over runs step up the load
+                   shedding level before OVER_RUN_ERROR.
+2.6.0  10-16-2026  Tasks released by the events are
+                   executed.
+2.6.0  10-16-2026  Completed tasks check in to the task
+                   watchdog.
+2.6.0  10-16-2026  Over run of the ISR lane is reported.
+2.6.0  10-16-2026  Lateness of the release after lost ticks
+                   is measured from its original due tick.
 --------------------------------------------------------------------------------
 */
 
 void Scheduler_run(void)
 {
   uint8_t Tasks_index = 0;
+  uint16_t dueTasksW = 0;
+  uint16_t readyTasksW = 0;
+  uint16_t taskMaskW = 0;
+  bool taskStatus = TASK_COMPLETED;
+#ifdef SCHEDULER_PROFILE
+  uint16_t startTickW = 0;
+  uint16_t startCountW = 0;
 
-  for( Tasks_index = 0; Tasks_index < scheduler.noOfTasks; Tasks_index++)
-  {
-    // If Counter is non zero, decrement it and go to check next task
-    if(scheduler.scheduledTasks[Tasks_index].counterW) {
-      scheduler.scheduledTasks[Tasks_index].counterW--;
-      
-      if (scheduler.scheduledTasks[Tasks_index].taskStatus == TASK_NOT_COMPLETED) {
-        scheduler.scheduledTasks[Tasks_index].taskStatus =          \
-                scheduler.scheduledTasks[Tasks_index].Taskptr();
-      }
+  // This run serves the tick next to the previous run
+  scheduler.releaseTickW++;
+#endif
+
+  // Remove all the tasks due on this tick from the head of the queue
+  while ( (scheduler.queueHead != SCHEDULER_NO_TASK) &&                 \
+          (scheduler.scheduledTasks[scheduler.queueHead].counterW == 0)) {
+    dueTasksW |= (1u << scheduler.queueHead);
+    scheduler.queueHead = scheduler.scheduledTasks[scheduler.queueHead].nextTask;
+  }
+
+  // Down count the tick for the remaining tasks
+  if ( scheduler.queueHead != SCHEDULER_NO_TASK) {
+    scheduler.scheduledTasks[scheduler.queueHead].counterW--;
+  }
+
+#ifdef SCHEDULER_EVENT_TRIGGER
+  // Tasks released by their timer accept the events from now on
+  scheduler.startedTasksW |= dueTasksW;
+#endif
+
+  // Reload the due tasks with their interval
+  readyTasksW = dueTasksW;
+  for ( Tasks_index = 0; readyTasksW != 0; Tasks_index++, readyTasksW >>= 1) {
+    if ( readyTasksW & 1u) {
+      SchedulerQueueInsert(Tasks_index, SCHEDULER_TASK_INTERVAL(Tasks_index));
     }
-    else {
-      // When Counter is zero, Execute the task and reload it with backup time
-      scheduler.scheduledTasks[Tasks_index].taskStatus =            \
-              scheduler.scheduledTasks[Tasks_index].Taskptr();
+  }
+
+  // Execute the due tasks and the tasks waiting to complete
+  readyTasksW = dueTasksW | scheduler.pendingTasksW;
+#ifdef SCHEDULER_EVENT_TRIGGER
+  readyTasksW |= scheduler.eventTasksW;
+#endif
+  for ( Tasks_index = 0, taskMaskW = 1; readyTasksW != 0;               \
+          Tasks_index++, taskMaskW <<= 1) {
+    if ( readyTasksW & taskMaskW) {
+      readyTasksW &= ~taskMaskW;
+
+#ifdef SCHEDULER_EVENT_TRIGGER
+      // Restart the maximum interval timer of the task released by the event
+      if ( scheduler.eventTasksW & taskMaskW) {
+        scheduler.eventTasksW &= ~taskMaskW;
+        if ( !(dueTasksW & taskMaskW)) {
+          SchedulerQueueRemove(Tasks_index);
+          SchedulerQueueInsert(Tasks_index, SCHEDULER_TASK_INTERVAL(Tasks_index));
+        }
+      }
+#endif
+
+#ifdef SCHEDULER_LOAD_SHEDDING
+      // Stretched task skips every other call, a skipped release is dropped
+      // and a skipped continued call is done on the next tick
+      if ( scheduler.shedTasksARYW[scheduler.shedLevel] & taskMaskW) {
+        scheduler.shedSkipTasksW ^= taskMaskW;
+        if ( scheduler.shedSkipTasksW & taskMaskW) {
+          if ( scheduler.shed[scheduler.shedLevel].skipsW != 0xFFFF) {
+            scheduler.shed[scheduler.shedLevel].skipsW++;
+          }
+          continue;
+        }
+      }
+#endif
+
+#ifdef SCHEDULER_PROFILE
+      SchedulerProfileTimeStamp(&startTickW, &startCountW);
+
+      // Lateness is only for the release, not for the continued calls
+      if ( dueTasksW & taskMaskW) {
+        SchedulerLatenessUpdate(Tasks_index, startTickW, startCountW);
+      }
+#endif
+
+      taskStatus = SCHEDULER_CALL_TASK(Tasks_index);
+#ifndef SCHEDULER_STATIC_TASKS
+      scheduler.scheduledTasks[Tasks_index].taskStatus = taskStatus;
+#endif
+
+#ifdef SCHEDULER_PROFILE
+      SchedulerProfileUpdate(Tasks_index, startTickW, startCountW);
+#endif
+
+      if ( taskStatus == TASK_NOT_COMPLETED) {
+        scheduler.pendingTasksW |= taskMaskW;
+      }
+      else {
+        scheduler.pendingTasksW &= ~taskMaskW;
+#ifdef SCHEDULER_TASK_WATCHDOG
+        scheduler.checkInTickARYW[Tasks_index] = scheduler.tickCountW;
+#endif
+      }
 
-      scheduler.scheduledTasks[Tasks_index].counterW =              \
-              scheduler.scheduledTasks[Tasks_index].scheduledTimeW;
-    }            
+#ifdef SCHEDULER_EVENT_TRIGGER
+      // Tasks released by this task and coming after it run in this tick
+      readyTasksW |= (scheduler.eventTasksW & ~((uint16_t)(taskMaskW << 1) - 1u));
+#endif
+    }
   }
 
   // Check interrupt flag is set again
@@ -142,11 +1129,275 @@ void Scheduler_run(void)
     // Increment the over run counter
     scheduler.overRunCounter++;
     
+#ifdef SCHEDULER_LOAD_SHEDDING
+    SchedulerLoadShed(1);
+#else
     if(scheduler.overRunCounter > MAX_OVERRUNS) {
       faultIndication.Error(OVER_RUN_ERROR);
     }
+#endif
   }
   else {
     scheduler.overRunCounter = 0;
+#ifdef SCHEDULER_LOAD_SHEDDING
+    SchedulerLoadShed(0);
+#endif
+  }
+
+#ifdef SCHEDULER_PROFILE
+  // Tasks released in this run are measured from their original due tick
+  // above, now skip the ticks lost by the previous run
+  scheduler.releaseTickW += scheduler.releaseLostTicksW;
+  scheduler.releaseLostTicksW = 0;
+
+  // If ticks are lost in this run, the run after the next serves the latest
+  // tick
+  if ( (uint16_t)(scheduler.tickCountW - scheduler.releaseTickW) > 1) {
+    scheduler.releaseLostTicksW = scheduler.tickCountW -                   \
+            scheduler.releaseTickW - 1;
+  }
+#endif
+
+#ifdef SCHEDULER_ISR_LANE
+  // Over run latched by the ISR lane, a latch missed here is set again on the
+  // next tick as the over run counter stays at MAX_OVERRUNS
+  if ( scheduler.isrOverRunFLG) {
+    scheduler.isrOverRunFLG = false;
+    faultIndication.Error(OVER_RUN_ERROR);
+  }
+#endif
+}
+
+
+#ifdef SCHEDULER_TASK_WATCHDOG
+// Watchdog task with SCHEDULER_WATCHDOG_RESET_MARK, not cleared by the reset
+static uint16_t schedulerWatchdogResetW SCHEDULER_PERSISTENT;
+
+/*
+================================================================================
+Method name:    SchedulerWatchdogWindow
+                    
+Originator:   
+
+Description: 
+  Return the watchdog window of the task in ticks, SCHEDULER_WATCHDOG_INTERVALS
+  times the task interval and at least SCHEDULER_WATCHDOG_MIN_TICKS.
+
+  This method should be called using SchedulerWatchdogWindow().
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write, moved from
+                   Scheduler_tasks_alive
+--------------------------------------------------------------------------------
+*/
+
+static uint16_t SchedulerWatchdogWindow(uint8_t taskIndex)
+{
+  uint16_t windowW = 0;
+
+  windowW = (SCHEDULER_TASK_INTERVAL(taskIndex) + 1) *                    \
+          SCHEDULER_WATCHDOG_INTERVALS;
+  if ( windowW < SCHEDULER_WATCHDOG_MIN_TICKS) {
+    windowW = SCHEDULER_WATCHDOG_MIN_TICKS;
+  }
+
+  return windowW;
+}
+
+/*
+================================================================================
+Method name:    Scheduler_tasks_alive
+                    
+Originator:   
+
+Description: 
+  Check every task has returned TASK_COMPLETED within its watchdog window. The
+  window is SCHEDULER_WATCHDOG_INTERVALS times the task interval, at least
+  SCHEDULER_WATCHDOG_MIN_TICKS ticks. For the event tasks it is counted on the
+  maximum interval. Only the late check in is supervised, as the event tasks
+  and the stretched tasks may check in earlier or later than their interval.
+  The first task missed its window is kept in scheduler.watchdogTask and in
+  the persistent RAM, and TASK_WATCHDOG_ERROR is reported. From then on this
+  method returns false, so main() stops refreshing the watchdog and the CPU is
+  reset.
+
+  After a watchdog reset, the window of the task which caused it is counted
+  from its first release. When the task has run more than one full window
+  without missing it, TASK_WATCHDOG_ERROR, scheduler.watchdogResetTask and the
+  persistent RAM are cleared.
+
+  This method should be called using scheduler.TasksAlive() method.
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+2.6.0  10-16-2026  Task is kept in the persistent RAM.
+2.6.0  10-16-2026  Task of the watchdog reset is cleared
+                   after it runs a full window.
+--------------------------------------------------------------------------------
+*/
+
+bool Scheduler_tasks_alive(void)
+{
+  uint8_t Tasks_index = 0;
+  uint16_t windowW = 0;
+  uint16_t tickW = scheduler.tickCountW;
+
+  if ( scheduler.watchdogTask != SCHEDULER_NO_TASK) {
+    return false;
+  }
+
+  for ( Tasks_index = 0; Tasks_index < scheduler.noOfTasks; Tasks_index++) {
+    windowW = SchedulerWatchdogWindow(Tasks_index);
+
+    // Check in tick is ahead of the tick count till the first release
+    if ( (int16_t)(tickW - scheduler.checkInTickARYW[Tasks_index]) >     \
+            (int16_t)windowW) {
+      scheduler.watchdogTask = Tasks_index;
+      schedulerWatchdogResetW = SCHEDULER_WATCHDOG_RESET_MARK | Tasks_index;
+      faultIndication.Error(TASK_WATCHDOG_ERROR);
+      return false;
+    }
+  }
+
+  // Task of the last watchdog reset has recovered after a full window
+  Tasks_index = scheduler.watchdogResetTask;
+  if ( Tasks_index < scheduler.noOfTasks) {
+    if ( (int16_t)(tickW - scheduler.checkInTickARYW[Tasks_index]) < 0) {
+      // Not released yet, the window starts from the first release
+      scheduler.watchdogRecoveryTickW = scheduler.checkInTickARYW[Tasks_index];
+    }
+    else if ( (int16_t)(tickW - scheduler.watchdogRecoveryTickW) >       \
+            (int16_t)SchedulerWatchdogWindow(Tasks_index)) {
+      scheduler.watchdogResetTask = SCHEDULER_NO_TASK;
+      schedulerWatchdogResetW = 0;
+      faultIndication.Clear(TASK_WATCHDOG_ERROR);
+    }
+  }
+
+  return true;
+}
+
+
+/*
+================================================================================
+Method name:    Scheduler_check_watchdog_reset
+                    
+Originator:   
+
+Description: 
+  Called from main() at the start up. If the CPU is reset by the watchdog time
+  out and the persistent RAM holds a task with SCHEDULER_WATCHDOG_RESET_MARK,
+  the task has stopped the watchdog refresh before the reset. Its index is kept
+  in scheduler.watchdogResetTask and TASK_WATCHDOG_ERROR is reported. The
+  persistent RAM is random after a power on, so it is checked only with the
+  time out flag. The flag is cleared here. The persistent RAM is kept till
+  scheduler.TasksAlive() finds the task recovered, so a watchdog reset for
+  another reason before that reports the task again.
+
+  This method should be called using scheduler.CheckWatchdogReset() method.
+
+Resources:
+  RCON
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+2.6.0  10-16-2026  Persistent RAM is kept till the task
+                   recovers.
+--------------------------------------------------------------------------------
+*/
+
+void Scheduler_check_watchdog_reset(void)
+{
+  if ( (SCHEDULER_WATCHDOG_RESET()) &&                                    \
+          ((schedulerWatchdogResetW & 0xFF00u) == SCHEDULER_WATCHDOG_RESET_MARK)) {
+    scheduler.watchdogResetTask = (uint8_t) schedulerWatchdogResetW;
+    // Tasks are released from now on, the window is counted from here at most
+    scheduler.watchdogRecoveryTickW = scheduler.tickCountW;
+    faultIndication.Error(TASK_WATCHDOG_ERROR);
+  }
+  else {
+    schedulerWatchdogResetW = 0;
+  }
+
+  SCHEDULER_WATCHDOG_RESET_CLEAR();
+}
+#endif
+
+
+#ifdef SCHEDULER_TICKLESS_IDLE
+/*
+================================================================================
+Method name:    Scheduler_idle
+                    
+Originator:   
+
+Description: 
+  Called from main() when there is no tick to serve. The CPU is put in Idle
+  mode till the Timer ISR sets the interruptFLG. The interrupts are masked while
+  checking the flag, so a tick occurring just before the Idle instruction still
+  wakes up the CPU and it is serviced once the interrupts are restored.
+
+  When no task is due on the tick and no task is waiting to complete, the tick
+  is counted down here and the CPU goes back to Idle. The method returns when a
+  task is due, so the wake-ups of main() are stretched till the next deadline.
+  After SCHEDULER_MAX_IDLE_TICKS it returns anyway to let main() refresh the
+  watchdog. The Timer ISR still runs every tick, so the AC line cross detection
+  and the TMR4 interrupt monitor are not affected.
+
+  This method should be called using scheduler.WaitForTask() method.
+
+Resources:
+  None
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+void Scheduler_idle(void)
+{
+  int16_t savedIPL = 0;
+  uint16_t idleTicksW = 0;
+
+  while ( 1) {
+    // Sleep till the next tick or any other interrupt
+    SCHEDULER_MASK_INTERRUPTS(savedIPL);
+    if ( !scheduler.flags.interruptFLG) {
+      SCHEDULER_CPU_IDLE();
+    }
+    SCHEDULER_UNMASK_INTERRUPTS(savedIPL);
+
+    // Woken up by other interrupt, wait for the tick
+    if ( !scheduler.flags.interruptFLG) {
+      continue;
+    }
+
+    // Return to main() to run the tasks or to refresh the watchdog
+    if ( (scheduler.pendingTasksW != 0) ||                                \
+            (SCHEDULER_EVENT_TASKS() != 0) ||                             \
+            (scheduler.queueHead == SCHEDULER_NO_TASK) ||                 \
+            (scheduler.scheduledTasks[scheduler.queueHead].counterW == 0) || \
+            (idleTicksW >= SCHEDULER_MAX_IDLE_TICKS)) {
+      break;
+    }
+
+    // No task is due on this tick, count it down and go back to Idle
+    scheduler.flags.interruptFLG = 0;
+    scheduler.scheduledTasks[scheduler.queueHead].counterW--;
+    idleTicksW++;
+#ifdef SCHEDULER_PROFILE
+    scheduler.releaseTickW++;
+#endif
   }
 }
+#endif
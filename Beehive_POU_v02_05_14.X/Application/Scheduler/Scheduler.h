@@ -13,15 +13,94 @@ Description:
   to run the scheduler.   It calls all the time based functions and handles all
   fault and events generated in class level objects.
 
-  Whenever interrupt occurs it will down count the counter for each task and
-  when it expired, scheduler execute the task and reloads the counter.
+  The tasks are kept in a delta queue sorted by their next due tick. Each entry
+  holds the ticks remaining after the entry in front of it, so on every tick
+  only the head counter is down counted and only the tasks which are due (or
+  still returning TASK_NOT_COMPLETED) are touched.
+
+  When SCHEDULER_PROFILE is defined in Build.h, every task call is measured with
+  the 1 ms tick count and the TMR1 counter. Minimum, average and maximum time
+  and a log2 histogram are kept per task for the serial debug port. The release
+  lateness, from the start of the tick the task is due to its start, is kept as
+  worst case and log2 histogram too.
+
+  When SCHEDULER_TICKLESS_IDLE is defined, main() puts the CPU in Idle mode till
+  a task is due. Ticks with no task due are counted down in Idle without
+  returning to main(). TMR1 keeps its 1 ms period, since the Timer ISR samples
+  the AC line cross input every tick and TMR4 monitors the ISR count.
+
+  When SCHEDULER_STATIC_TASKS is defined, the tasks are taken from the constant
+  SCHEDULER_TASK_TABLE instead of scheduler.AddTask(). The intervals are kept in
+  flash, the tasks are called directly and the table is checked at compile time
+  for its size and for the phase collision of the slow tasks.
+
+  When SCHEDULER_ISR_LANE is defined, the 1 ms critical tasks in
+  SCHEDULER_ISR_LANE_TABLE are called from the Timer ISR right after the AC line
+  cross sampling. Each of them is timed against its budget in TMR1 counts, and
+  their continuous over run is reported by the background lane, since the fault
+  list is not protected from the interrupts. The remaining tasks form the
+  background lane run from main() and may slip.
+
+  When SCHEDULER_LOAD_SHEDDING is defined, continuous over runs step up the
+  shedding level instead of reporting OVER_RUN_ERROR at once. Each task is added
+  with the level from which it is stretched to half rate: first the debug print,
+  UI refresh and self test, then the ADC scan. OVER_RUN_ERROR is reported only
+  when the over runs continue at the last level, that is the critical tasks
+  still miss their tick. The level steps down after SCHEDULER_SHED_RECOVERY_TICKS
+  ticks without over run.
+
+  When SCHEDULER_EVENT_TRIGGER is defined, a task can wait for a scheduler event
+  signalled by another task with scheduler.SignalEvent(). The task is released
+  on the tick the event is signalled, and its interval becomes a maximum
+  interval timer which is restarted on every event release. If the signalling
+  task comes earlier in the task order, the waiting task runs in the same tick.
+  Events signalled before the first release of the task are ignored, so the
+  initial delay is kept.
+
+  When SCHEDULER_TASK_WATCHDOG is defined, each task checks in whenever it
+  returns TASK_COMPLETED. main() refreshes the watchdog only when
+  scheduler.TasksAlive() finds every task checked in within its window of
+  SCHEDULER_WATCHDOG_INTERVALS intervals, at least SCHEDULER_WATCHDOG_MIN_TICKS
+  ticks, counted from its first release. A task stuck in TASK_NOT_COMPLETED or
+  never released again is reported as TASK_WATCHDOG_ERROR with its index in
+  scheduler.watchdogTask, and the watchdog resets the CPU. The index is kept in
+  the persistent RAM over the reset, and on the start up after the watchdog time
+  out scheduler.CheckWatchdogReset() reports TASK_WATCHDOG_ERROR again with the
+  index in scheduler.watchdogResetTask. Once that task has run a full watchdog
+  window after the reset, the error and the index are cleared.
 
 Class Methods:
   void Scheduler_run(void);
     Execute the tasks scheduled whenever timer interrupt occurs
 
-  int32_t Scheduler_add_task(void (*Taskptr)(void), uint32_t TimeW);
-    To add the task and time interval into the scheduler 
+  int32_t Scheduler_add_task(void (*Taskptr)(void), uint16_t initialDelayW,
+  uint16_t TimeW, uint8_t shedLevel);
+    To add the task, time interval and shedding level into the scheduler 
+
+  void Scheduler_reset_profile(void);
+    To clear the execution time measured for all the tasks
+
+  void Scheduler_idle(void);
+    To keep the CPU in Idle mode till a task is due
+
+  void Scheduler_init(void);
+    To queue the tasks of the compile time task table
+
+  void Scheduler_run_isr_lane(void);
+    To execute the ISR lane tasks from the Timer ISR
+
+  int32_t Scheduler_add_event_task(bool (*Taskptr)(void), uint16_t initialDelayW,
+  uint16_t maxTimeW, uint8_t shedLevel, uint8_t eventId);
+    To add the task released on the event or after the maximum interval
+
+  void Scheduler_signal_event(uint8_t eventId);
+    To release the tasks waiting for the event
+
+  bool Scheduler_tasks_alive(void);
+    To check all the tasks checked in within their watchdog window
+
+  void Scheduler_check_watchdog_reset(void);
+    To report the task which caused the watchdog reset
 
 Resources:
  None
@@ -30,6 +109,27 @@ Resources:
 -*-----*-----------*------------------------------------*-----------------------
        09-23-2019  Initial Write                        Poorana kumar G
 2.3.0  09-15-2020  UI Scheduled time is changed as 2 ms Poorana kumar G
+2.6.0  10-16-2026  Per task down counters are replaced
+                   with a delta queue.
+2.6.0  10-16-2026  Task execution time profile is added.
+2.6.0  10-16-2026  Tickless Idle method is added.
+2.6.0  10-16-2026  Compile time task table is added.
+2.6.0  10-16-2026  ISR lane for the 1 ms critical tasks.
+2.6.0  10-16-2026  Task release lateness is measured.
+2.6.0  10-16-2026  Load shedding levels are added.
+2.6.0  10-16-2026  Event triggered tasks are added.
+2.6.0  10-16-2026  Task watchdog check in is added.
+2.6.0  10-16-2026  ADC read interval for the DMA scan.
+2.6.0  10-16-2026  DMA scan period is kept with the
+                   oversampling.
+2.6.0  10-16-2026  ISR lane over run flag is added.
+2.6.0  10-16-2026  Watchdog task is kept over the reset.
+2.6.0  10-16-2026  Lost ticks are kept till the lateness
+                   of the next releases is measured.
+2.6.0  10-16-2026  ADC scan period for the scan event is
+                   removed.
+2.6.0  10-16-2026  Watchdog task is cleared after it runs a
+                   full window.
 --------------------------------------------------------------------------------
 */
 
@@ -39,6 +139,143 @@ Resources:
 
 #include "Build.h"
 
+#ifdef SCHEDULER_ISR_LANE
+// ISR lane task table, TASK(function, budget in TMR1 counts). Tasks are called
+// in this order from the Timer ISR every 1 ms.
+#define SCHEDULER_ISR_LANE_TABLE(TASK)                                        \
+  TASK(OptoCouplerModulate, OPTOCOUPLER_CONTROL_BUDGET)                       \
+  TASK(FlowDetectorSample,  FLOW_DETECTOR_SAMPLE_BUDGET)
+
+// Index of each task in the ISR lane table
+#define SCHEDULER_ISR_TASK_ID(function, budget)                               \
+  SCHEDULER_ISR_TASK_##function,
+
+typedef enum {
+  SCHEDULER_ISR_LANE_TABLE(SCHEDULER_ISR_TASK_ID)
+  SCHEDULER_ISR_LANE_TASKS
+} SchedulerISRTask_ETYP;
+
+// Execution time of the ISR lane task in TMR1 counts (8 Tcy, 0.533 us)
+typedef struct {
+  // Longest execution time
+  uint16_t maxW;
+  // Total number of budget over runs
+  uint16_t overRunsW;
+  // Worst delay from the start of the tick to the task start
+  uint16_t latenessMaxW;
+  // Continuous budget over runs
+  uint8_t overRunCounter;
+} SchedulerISRLane_STYP;
+
+// Opto coupler control runs in the ISR lane
+#define SCHEDULER_OPTO_TASK(TASK)
+#else
+#define SCHEDULER_OPTO_TASK(TASK)                                             \
+  TASK(OptoCouplerModulate, OPTOCOUPLER_CONTROL_INITIAL_DELAY,                \
+          OPTOCOUPLER_CONTROL_INTERVAL, SCHEDULER_SHED_NONE)
+#endif
+
+// Load shedding level of the scheduler. A task added with a level other than
+// SCHEDULER_SHED_NONE is stretched to half rate from that level onwards.
+typedef enum {
+  // Normal load, critical tasks are never stretched
+  SCHEDULER_SHED_NONE = 0,
+  // Debug print, UI refresh and self test are stretched
+  SCHEDULER_SHED_BACKGROUND,
+  // ADC scan is stretched too
+  SCHEDULER_SHED_ADC_SCAN,
+  SCHEDULER_SHED_LEVELS
+} SchedulerShed_ETYP;
+
+// Scheduler events signalled by the tasks
+typedef enum {
+  // All the ADC channels are converted for the temperature control
+  SCHEDULER_EVENT_ADC_SCAN_COMPLETE = 0,
+  SCHEDULER_EVENTS
+} SchedulerEvent_ETYP;
+
+#ifdef SCHEDULER_LOAD_SHEDDING
+// Load shedding counters of each level
+typedef struct {
+  // Number of times the level is entered
+  uint16_t entriesW;
+  // Number of task calls skipped in the level
+  uint16_t skipsW;
+} SchedulerShed_STYP;
+#endif
+
+#ifdef SCHEDULER_STATIC_TASKS
+// Debug task is scheduled only in debug build
+#ifdef DEBUG_MACRO
+#define SCHEDULER_DEBUG_TASK(TASK)                                            \
+  TASK(SerialDebugProcess,  SERIAL_DEBUG_INITIAL_DELAY,                       \
+          SERIAL_DEBUG_INTERVAL,        SCHEDULER_SHED_BACKGROUND)
+#else
+#define SCHEDULER_DEBUG_TASK(TASK)
+#endif
+
+// Compile time task table, TASK(function, initial delay, interval, shedding
+// level). Tasks due on the same tick are executed in this order.
+#define SCHEDULER_TASK_TABLE(TASK)                                            \
+  SCHEDULER_OPTO_TASK(TASK)                                                   \
+  TASK(UserInterface,       USER_INTERFACE_INITIAL_DELAY,                     \
+          USER_INTERFACE_INTERVAL,      SCHEDULER_SHED_BACKGROUND)            \
+  TASK(FlowDetector,        FLOW_DETECTOR_INITIAL_DELAY,                      \
+          FLOW_DETECTOR_INTERVAL,       SCHEDULER_SHED_NONE)                  \
+  TASK(ADCRead,             ADC_READ_INITIAL_DELAY,                           \
+          ADC_READ_INTERVAL,            SCHEDULER_SHED_ADC_SCAN)              \
+  TASK(BuzzerLEDControl,    FAULT_INDICATION_INITIAL_DELAY,                   \
+          FAULT_INDICATION_INTERVAL,    SCHEDULER_SHED_NONE)                  \
+  TASK(ModeCheckFunction,   MODE_CHECK_INITIAL_DELAY,                         \
+          MODE_CHECK_INTERVAL,          SCHEDULER_SHED_NONE)                  \
+  TASK(ClassB_RunTimeTest,  SELFTEST_INITIAL_DELAY,                           \
+          SELFTEST_INTERVAL,            SCHEDULER_SHED_BACKGROUND)            \
+  TASK(TemperatureControl,  TEMPERATURE_CONTROL_INITIAL_DELAY,                \
+          TEMPERATURE_CONTROL_TASK_INTERVAL, SCHEDULER_SHED_NONE)             \
+  SCHEDULER_DEBUG_TASK(TASK)
+
+// Index of each task in the task table
+#define SCHEDULER_TASK_ID(function, initialDelay, interval, shedLevel)        \
+  SCHEDULER_TASK_##function,
+
+typedef enum {
+  SCHEDULER_TASK_TABLE(SCHEDULER_TASK_ID)
+  SCHEDULER_STATIC_TASK_COUNT
+} SchedulerTask_ETYP;
+
+#define SCHEDULER_TASK_SLOTS                SCHEDULER_STATIC_TASK_COUNT
+
+// Tasks of the task table waiting for the events, EVENT(event, function). The
+// interval of the task in the task table is its maximum interval.
+#define SCHEDULER_EVENT_TABLE(EVENT)                                          \
+  EVENT(SCHEDULER_EVENT_ADC_SCAN_COMPLETE, TemperatureControl)
+#else
+#define SCHEDULER_TASK_SLOTS                SCHEDULER_MAX_TASKS
+#endif
+
+#ifdef SCHEDULER_PROFILE
+// Number of log2 bins in the task execution time histogram
+#define SCHEDULER_PROFILE_BINS              12
+
+// Execution time measured for a task in TMR1 counts (8 Tcy, 0.533 us)
+typedef struct {
+  // Shortest execution time
+  uint16_t minW;
+  // Longest execution time
+  uint16_t maxW;
+  // Number of executions added in sumL
+  uint16_t countW;
+  // Sum of the execution times to find the average
+  uint32_t sumL;
+  // Bin n counts the times from 2^n to (2^(n+1) - 1), last bin holds the rest
+  uint16_t histogramARYW[SCHEDULER_PROFILE_BINS];
+  // Worst delay from the start of the due tick to the task start
+  uint16_t latenessMaxW;
+  // Log2 histogram of the delay to the task start, same bins as above
+  uint16_t latenessHistogramARYW[SCHEDULER_PROFILE_BINS];
+} SchedulerProfile_STYP;
+#endif
+
 //CLASS OBJECT DEFINITION
 typedef struct {  
 
@@ -47,49 +284,196 @@ typedef struct {
     // INPUT:Set by Timer ISR every 1 ms to let main() know to call Scheduler.run()
     uint8_t interruptFLG:1;
   } flags;
+  // INPUT: Incremented by Timer ISR every 1 ms
+  volatile uint16_t tickCountW;
   // OUTPUT: No of tasks scheduled in the scheduler
   uint8_t noOfTasks;
+  // OUTPUT: Present load shedding level
+  SchedulerShed_ETYP shedLevel;
+  // OUTPUT: Index of the task missed its watchdog window first
+  uint8_t watchdogTask;
+  // OUTPUT: Index of the task which caused the last watchdog reset
+  uint8_t watchdogResetTask;
   struct {
-    // INPUT: The counter which will be down counted after each ticks
+    // INPUT: Ticks to wait after the previous task in the delta queue
     uint16_t counterW;
+#ifndef SCHEDULER_STATIC_TASKS
     // INPUT: Time interval to execute the task
     uint16_t scheduledTimeW;
     // INPUT: The pointer of the function which have to be executed
     bool (* Taskptr)(void);
     // The boolean variable to store the task completion
     bool taskStatus;
-  }scheduledTasks[SCHEDULER_MAX_TASKS];
+#endif
+    // Index of the next task in the delta queue
+    uint8_t nextTask;
+  }scheduledTasks[SCHEDULER_TASK_SLOTS];
 
 // Public Methods
   void (* run)(void);
-  int32_t (* AddTask)(bool (*Taskptr)(void), uint16_t initialDelayW, uint16_t TimeW);
+#ifdef SCHEDULER_STATIC_TASKS
+  void (* Init)(void);
+#else
+  int32_t (* AddTask)(bool (*Taskptr)(void), uint16_t initialDelayW, uint16_t TimeW, uint8_t shedLevel);
+#endif
+#ifdef SCHEDULER_PROFILE
+  void (* ResetProfile)(void);
+#endif
+#ifdef SCHEDULER_TICKLESS_IDLE
+  void (* WaitForTask)(void);
+#endif
+#ifdef SCHEDULER_ISR_LANE
+  void (* RunISRLane)(void);
+#endif
+#ifdef SCHEDULER_EVENT_TRIGGER
+#ifndef SCHEDULER_STATIC_TASKS
+  int32_t (* AddEventTask)(bool (*Taskptr)(void), uint16_t initialDelayW, uint16_t maxTimeW, uint8_t shedLevel, uint8_t eventId);
+#endif
+  void (* SignalEvent)(uint8_t eventId);
+#endif
+#ifdef SCHEDULER_TASK_WATCHDOG
+  bool (* TasksAlive)(void);
+  void (* CheckWatchdogReset)(void);
+#endif
   
   uint8_t overRunCounter;
+
+// Private Variables
+  // Index of the task which is due first
+  uint8_t queueHead;
+  // Bit mask of the tasks returned TASK_NOT_COMPLETED, called on every tick
+  uint16_t pendingTasksW;
+#ifdef SCHEDULER_PROFILE
+  // Execution time measured for each task
+  SchedulerProfile_STYP profile[SCHEDULER_TASK_SLOTS];
+  // Tick served by the current scheduler run
+  uint16_t releaseTickW;
+  // Ticks lost by the previous run, skipped after the releases of this run
+  uint16_t releaseLostTicksW;
+#endif
+#ifdef SCHEDULER_ISR_LANE
+  // Execution time measured for each ISR lane task
+  SchedulerISRLane_STYP isrLane[SCHEDULER_ISR_LANE_TASKS];
+  // Set by the ISR lane on continuous over runs, reported by Scheduler_run()
+  volatile bool isrOverRunFLG;
+#endif
+#ifdef SCHEDULER_LOAD_SHEDDING
+  // Bit mask of the tasks stretched in each shedding level
+  uint16_t shedTasksARYW[SCHEDULER_SHED_LEVELS];
+  // Bit mask of the stretched tasks which skip their next call
+  uint16_t shedSkipTasksW;
+  // Ticks without over run in the present shedding level
+  uint16_t shedRecoveryW;
+  // Counters of each shedding level
+  SchedulerShed_STYP shed[SCHEDULER_SHED_LEVELS];
+#endif
+#ifdef SCHEDULER_EVENT_TRIGGER
+  // Bit mask of the tasks waiting for each event
+  uint16_t eventSubscribersARYW[SCHEDULER_EVENTS];
+  // Bit mask of the tasks released by the events, not executed yet
+  uint16_t eventTasksW;
+  // Bit mask of the tasks released at least once by their timer
+  uint16_t startedTasksW;
+#endif
+#ifdef SCHEDULER_TASK_WATCHDOG
+  // Tick of the last TASK_COMPLETED of each task, or of its first release
+  uint16_t checkInTickARYW[SCHEDULER_TASK_SLOTS];
+  // Tick the task of the last watchdog reset is released first after the reset
+  uint16_t watchdogRecoveryTickW;
+#endif
 } Scheduler_STYP;
 
 
 //  CLASS METHOD PROTOTYPES
 void Scheduler_run(void);
-int32_t Scheduler_add_task(bool (*Taskptr)(void), uint16_t initialDelayW, uint16_t TimeW);
+int32_t Scheduler_add_task(bool (*Taskptr)(void), uint16_t initialDelayW, uint16_t TimeW, uint8_t shedLevel);
+void Scheduler_reset_profile(void);
+void Scheduler_idle(void);
+void Scheduler_init(void);
+void Scheduler_run_isr_lane(void);
+int32_t Scheduler_add_event_task(bool (*Taskptr)(void), uint16_t initialDelayW, uint16_t maxTimeW, uint8_t shedLevel, uint8_t eventId);
+void Scheduler_signal_event(uint8_t eventId);
+bool Scheduler_tasks_alive(void);
+void Scheduler_check_watchdog_reset(void);
 
 
 // DEFINE CLASS OBJECT DEFAULTS
+#ifdef SCHEDULER_PROFILE
+#define SCHEDULER_PROFILE_DEFAULTS  .ResetProfile = &Scheduler_reset_profile,
+#else
+#define SCHEDULER_PROFILE_DEFAULTS
+#endif
+
+#ifdef SCHEDULER_TICKLESS_IDLE
+#define SCHEDULER_IDLE_DEFAULTS     .WaitForTask = &Scheduler_idle,
+#else
+#define SCHEDULER_IDLE_DEFAULTS
+#endif
+
+#ifdef SCHEDULER_ISR_LANE
+#define SCHEDULER_ISR_LANE_DEFAULTS .RunISRLane = &Scheduler_run_isr_lane,
+#else
+#define SCHEDULER_ISR_LANE_DEFAULTS
+#endif
+
+#ifdef SCHEDULER_EVENT_TRIGGER
+#ifdef SCHEDULER_STATIC_TASKS
+#define SCHEDULER_EVENT_DEFAULTS    .SignalEvent = &Scheduler_signal_event,
+#else
+#define SCHEDULER_EVENT_DEFAULTS    .AddEventTask = &Scheduler_add_event_task, \
+                                    .SignalEvent = &Scheduler_signal_event,
+#endif
+#else
+#define SCHEDULER_EVENT_DEFAULTS
+#endif
+
+#ifdef SCHEDULER_TASK_WATCHDOG
+#define SCHEDULER_WATCHDOG_DEFAULTS .TasksAlive = &Scheduler_tasks_alive, \
+                                    .CheckWatchdogReset = &Scheduler_check_watchdog_reset,
+#else
+#define SCHEDULER_WATCHDOG_DEFAULTS
+#endif
+
+#ifdef SCHEDULER_STATIC_TASKS
+#define SCHEDULER_TASKS_DEFAULTS    .Init = &Scheduler_init,
+#else
+#define SCHEDULER_TASKS_DEFAULTS    .AddTask = &Scheduler_add_task,
+#endif
+
 #define SCHEDULER_DEFAULTS {                \
   .run              = &Scheduler_run,       \
-  .AddTask          = &Scheduler_add_task,  \
-  .overRunCounter  = 0                     \
+  SCHEDULER_TASKS_DEFAULTS                  \
+  SCHEDULER_PROFILE_DEFAULTS                \
+  SCHEDULER_IDLE_DEFAULTS                   \
+  SCHEDULER_ISR_LANE_DEFAULTS               \
+  SCHEDULER_EVENT_DEFAULTS                  \
+  SCHEDULER_WATCHDOG_DEFAULTS               \
+  .overRunCounter  = 0,                    \
+  .shedLevel        = SCHEDULER_SHED_NONE,  \
+  .watchdogTask     = SCHEDULER_NO_TASK,    \
+  .watchdogResetTask = SCHEDULER_NO_TASK,   \
+  .queueHead        = SCHEDULER_NO_TASK,    \
+  .pendingTasksW    = 0                     \
 }
 
 // OTHER DEFINITIONS
 
 //Scheduler tasks interval time in milliseconds
-#ifdef DISABLE_INLET_THERMISTOR
+#ifdef ADCREAD_DMA_SCAN
+// DMA scan buffer is checked twice per 10 ms scan
+#define ADC_READ_INTERVAL               5
+#elif defined DISABLE_INLET_THERMISTOR
 #define ADC_READ_INTERVAL               60//14
 #else
 #define ADC_READ_INTERVAL               12
 #endif
 #define FAULT_INDICATION_INTERVAL       250
+#ifdef SCHEDULER_ISR_LANE
+// Flow pulses are counted in the ISR lane, only the 1 sec window is checked
+#define FLOW_DETECTOR_INTERVAL          10
+#else
 #define FLOW_DETECTOR_INTERVAL          1
+#endif
 #define MODE_CHECK_INTERVAL             1250
 #define OPTOCOUPLER_CONTROL_INTERVAL    1
 #define SELFTEST_INTERVAL               500
@@ -98,6 +482,16 @@ int32_t Scheduler_add_task(bool (*Taskptr)(void), uint16_t initialDelayW, uint16
 // UI scheduled time - 2 msec - Finalized by client
 #define USER_INTERFACE_INTERVAL         2
 
+#ifdef SCHEDULER_EVENT_TRIGGER
+// Temperature control is released on every ADC scan complete event and steps
+// once per TEMPERATURE_CONTROL_INTERVAL. If the events stop, the timer runs it
+// after one more control interval.
+#define TEMPERATURE_CONTROL_MAX_INTERVAL    (TEMPERATURE_CONTROL_INTERVAL * 2)
+#define TEMPERATURE_CONTROL_TASK_INTERVAL   TEMPERATURE_CONTROL_MAX_INTERVAL
+#else
+#define TEMPERATURE_CONTROL_TASK_INTERVAL   TEMPERATURE_CONTROL_INTERVAL
+#endif
+
 //Scheduler tasks initial interval time in milliseconds to avoid tasks triggered on same time
 #define ADC_READ_INITIAL_DELAY              0
 #define FAULT_INDICATION_INITIAL_DELAY      20
@@ -115,6 +509,36 @@ int32_t Scheduler_add_task(bool (*Taskptr)(void), uint16_t initialDelayW, uint16
 
 #define MAX_OVERRUNS                        20
 
+// Ticks without over run to step down the load shedding level
+#define SCHEDULER_SHED_RECOVERY_TICKS       1000
+
+// ISR lane task budgets in TMR1 counts (0.533 us)
+#define OPTOCOUPLER_CONTROL_BUDGET          75  // 40 us
+#define FLOW_DETECTOR_SAMPLE_BUDGET         38  // 20 us
+
+// Maximum ticks counted down in Idle before main() refreshes the watchdog. It
+// is kept well below the watchdog period (1:32 x 1:1024 of LPRC, about 1 sec).
+#define SCHEDULER_MAX_IDLE_TICKS            250
+
+// Task watchdog window in task intervals, with a minimum in ticks for the fast
+// tasks. The window allows the stretched rate under load shedding.
+#define SCHEDULER_WATCHDOG_INTERVALS        4
+#define SCHEDULER_WATCHDOG_MIN_TICKS        100
+// Marks the watchdog task kept in the persistent RAM, in the upper byte
+#define SCHEDULER_WATCHDOG_RESET_MARK       0xA500u
+
+// Slow tasks of the compile time task table, with this interval or longer,
+// must have the interval in multiple of this period and different initial
+// delays in modulo of this period. So they are never due on the same tick.
+#define SCHEDULER_PHASE_PERIOD              250
+
+// Delta queue end marker
+#define SCHEDULER_NO_TASK                   0xFF
+
+#if (SCHEDULER_MAX_TASKS > 16)
+#error "Scheduler task masks are 16 bit wide"
+#endif
+
 // EXTERN VARIABLES
 extern Scheduler_STYP scheduler;
 
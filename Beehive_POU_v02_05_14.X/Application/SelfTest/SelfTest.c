@@ -50,6 +50,8 @@ Resources:
 2.3.0  09-14-2020  Code flash CRC check is changed to check Poorana kumar G
                    the CRC stored in NVM against calculated
                    one.
+2.6.0  10-16-2026  Run time tests due on the same call are
+                   executed on separate ticks.
 --------------------------------------------------------------------------------
 */
 
@@ -232,7 +234,10 @@ Originator:   Poorana kumar G
 
 Description: 
   Call periodically from Scheduler (500 msec), to execute the class B safety
-  test periodically to ensure the peripherals are working fine.
+  test periodically to ensure the peripherals are working fine. After a test is
+  executed, the task yields and the next test is checked on the next tick. So
+  the tests due on the same call do not add up in one tick. The clock test is a
+  single library call and still takes around 20 msec.
 
   This method should be called using selfTest.RunTimeTest().
 
@@ -245,6 +250,7 @@ Resources:
        11-04-2019  PC-Lint warning is cleared by        Poorana kumar G
                    updating the Class B PC test check
                    condition.
+2.6.0  10-16-2026  Yields to the scheduler after each test.
 --------------------------------------------------------------------------------
 */
 
@@ -253,6 +259,8 @@ bool ClassB_RunTimeTest(void)
   // Variable to hold the clock test result
   CLASSBRESULT clockTestResult = CLASSB_TEST_PASS;
 
+  PT_BEGIN(&selfTest.runTimeTestPT);
+
   // Execute CPU Register test
   if ( --selfTest.cpuRegisterTestTimerW == 0) {
     selfTest.cpuRegisterTestTimerW = CPU_REGISTER_TEST_INTERVAL;
@@ -260,6 +268,7 @@ bool ClassB_RunTimeTest(void)
     if ( CLASSB_CPURegistersTest() != CLASSB_TEST_PASS) {
       faultIndication.Error(CPU_REGISTER_TEST_ERROR);
     }
+    PT_YIELD(&selfTest.runTimeTestPT);
   }
 
   // Execute CPU Program counter test
@@ -270,6 +279,7 @@ bool ClassB_RunTimeTest(void)
     if ( CLASSB_CPUPCTestGetResult()) {
       faultIndication.Error(PROGRAM_COUNTER_TEST_ERROR);
     }
+    PT_YIELD(&selfTest.runTimeTestPT);
   }
 
   // Execute RAM Checker Board for entire RAM region
@@ -277,6 +287,7 @@ bool ClassB_RunTimeTest(void)
     selfTest.ramTestTimerW = RAM_TEST_INTERVAL;
 
     RAMTest();
+    PT_YIELD(&selfTest.runTimeTestPT);
   }
 
   // Execute CRC test for code flash region
@@ -284,6 +295,7 @@ bool ClassB_RunTimeTest(void)
     selfTest.flashCRCTestTimerW = FLASH_TEST_INTERVAL;
 
     CodeFlashTest();
+    PT_YIELD(&selfTest.runTimeTestPT);
   }
 
   // Execute EEPROM CRC test
@@ -293,6 +305,7 @@ bool ClassB_RunTimeTest(void)
     if(nonVol.ValidateCRC() != true) {
       faultIndication.Error(EEPROM_CRC_TEST_ERROR);
     }
+    PT_YIELD(&selfTest.runTimeTestPT);
   }
 
   // Execute the clock test
@@ -322,8 +335,6 @@ bool ClassB_RunTimeTest(void)
     }
   }
 
- 
-  
-  return TASK_COMPLETED;
+  PT_END(&selfTest.runTimeTestPT);
 }
 
@@ -23,7 +23,8 @@ Class Methods:
 
   void ClassB_RunTimeTest(void);
     Call periodically from Scheduler (500 msec), to execute the class B safety
-    test periodically to ensure the peripherals are working fine.
+    test periodically to ensure the peripherals are working fine. The tests
+    due on the same call are spread over the following ticks.
 
 Method Calling Requirements:
   selfTest.POST() should be called at Power ON.
@@ -43,6 +44,8 @@ Resources:
 2.3.0  09-14-2020  Code flash CRC check is changed to check Poorana kumar G
                    the CRC stored in NVM against calculated
                    one.
+2.6.0  10-16-2026  Run time test is made a resumable task,
+                   one test per tick.
 --------------------------------------------------------------------------------
 */
 
@@ -54,6 +57,7 @@ Resources:
 #include "classb.h"
 #include "nonVol.h"
 #include "FaultIndication.h"
+#include "Protothread.h"
 
 typedef struct{
 
@@ -74,6 +78,7 @@ typedef struct{
   uint16_t flashCRCTestTimerW;
   uint16_t eepromCRCTestTimerW;
   uint16_t clcokTestTimerW;
+  Protothread_STYP runTimeTestPT;
 }  SelfTest_STYP;
 
 // DEFINE CLASS OBJECT DEFAULTS
@@ -88,6 +93,7 @@ typedef struct{
                                 FLASH_TEST_INTERVAL,        \
                                 EEPROM_TEST_INTERVAL,       \
                                 CLOCK_TEST_INTERVAL,        \
+                                PROTOTHREAD_DEFAULTS,       \
                             }
 
 #define CPU_REGISTER_TEST_INTERVAL      120  // * 500ms = 60 seconds
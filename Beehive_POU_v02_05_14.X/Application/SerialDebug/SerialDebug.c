@@ -35,6 +35,29 @@ Class Methods:
     parameters are the number to be converted and Number of digits. This
     function return the number of digits filled in the buffer.
 
+  static int8_t PrintUnsigned(uint16_t number, int8_t digits);
+    Convert the unsigned integer into ASCII characters and fill it into the
+    buffer. This function return the number of digits filled in the buffer.
+
+  static void PrintTaskProfile(uint8_t taskIndex);
+    Print the execution time measured for the task by the scheduler.
+
+  static void PrintTaskLateness(uint8_t taskIndex);
+    Print the release lateness measured for the task by the scheduler.
+
+  static void PrintShedStatus(void);
+    Print the load shedding level and the counters of each level.
+
+  static void PrintISRLaneProfile(uint8_t laneIndex);
+    Print the longest time, the budget over runs and the worst lateness of the
+    ISR lane task.
+
+  static void PrintADCFilters(void);
+    Print the filter type and length of each ADC channel.
+
+  static void PrintSuppressed(void);
+    Print the implausible samples suppressed for each chamber thermistor.
+
 Method Calling Requirements:
   Serial.DebugFunction() should be called once per 500 millisecond in
   scheduler.
@@ -55,11 +78,31 @@ IoTranslate requirements:
 2.2.0  07-16-2020  UART error code is added for temperature  Poorana kumar G
                    mode error. Macro to disable the inlet 
                    temperature display in UART is disabled.
+2.6.0  10-16-2026  Command is added to print and clear the
+                   execution time of the scheduled tasks.
+2.6.0  10-16-2026  ISR lane tasks are added in the task
+                   profile print.
+2.6.0  10-16-2026  Command is added to print the release
+                   lateness of the scheduled tasks.
+2.6.0  10-16-2026  Command is added to print the load
+                   shedding counters.
+2.6.0  10-16-2026  UART error code is added for task
+                   watchdog error with the task index.
+2.6.0  10-16-2026  Command is added to print and change the
+                   ADC channel filters.
+2.6.0  10-16-2026  Command is added to print and clear the
+                   suppressed chamber thermistor samples.
+2.6.0  10-16-2026  Detected chamber thermistors are taken
+                   from the detected mask.
+2.6.0  10-16-2026  PID gains are loaded after a PID
+                   constant is changed.
+2.6.0  10-16-2026  Biquad ADC filter can be selected.
 --------------------------------------------------------------------------------
 */
 
 #include "SerialDebug.h"
 #include "FaultIndication.h"
+#include "Scheduler.h"
 
 #ifdef DEBUG_MACRO
 
@@ -72,6 +115,15 @@ static const char *modeStringsARY[] =
   "UNKNO"
 };
 
+// Debug strings for ADC filter types
+static const char *filterStringsARY[] =
+{
+  "IIR",
+  "AVG",
+  "MED",
+  "BQD"
+};
+
 // Debug strings for errors
 static const char *errorStringsARY[] =
 {
@@ -104,7 +156,8 @@ static const char *errorStringsARY[] =
   "T",      // Heater feedback test
   "U",      // EEPROM Flash CRC test
   "B",      // Button Malfunction
-  "J"       // Temperature Mode Jumper
+  "J",      // Temperature Mode Jumper
+  "K"       // Task watchdog, followed by the task index
 };
 
 
@@ -207,6 +260,61 @@ static int8_t PrintInteger(int16_t number, int8_t digits, int8_t forceNeg)
 }
 
 
+/*
+================================================================================
+Method name:  PrintUnsigned
+                    
+Originator:   
+
+Description: 
+  Convert the unsigned integer into ASCII characters and fill it into the
+  buffer. The parameters are the number to be converted and Number of digits.
+  This function return the number of digits filled in the buffer.
+
+  This method should be called using PrintUnsigned().
+
+Resources:
+  None
+
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+static int8_t PrintUnsigned(uint16_t number, int8_t digits)
+{
+  uint16_t i = 0;
+  int8_t value = 0;
+  int8_t started = 0;
+  int8_t j = 0;
+
+  if(number == 0) {
+    Serial.debugTxARY[j++] = '0';
+  }
+  else {
+    for ( i=10000; (i>0 && j < digits); i /= 10) {
+      value = 0;
+
+      if ( number >= i) {
+        started = 1;
+      	value = number / i;
+        number = number - (value * i);
+      }
+      value = value + '0';
+      if ( started) {
+        Serial.debugTxARY[j++] = value;
+      }
+    }
+  }
+
+  Serial.debugTxARY[j] = 0;
+
+  return j;
+}
+
+
 /*
 ================================================================================
 Method name:  PrintFloat
@@ -268,6 +376,318 @@ static int8_t PrintFloat(float number, int8_t digits, int8_t numFrac)
 }
 
 
+/*
+================================================================================
+Method name:  PrintADCFilters
+                    
+Originator:   
+
+Description: 
+  Print the filter type and the length (IIR shift, average taps, median points
+  or biquad cutoff) of each ADC channel.
+
+  This method should be called using PrintADCFilters().
+
+Resources:
+  None
+
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+2.6.0  10-16-2026  Biquad filter is printed.
+--------------------------------------------------------------------------------
+*/
+
+static void PrintADCFilters(void)
+{
+  uint8_t digitCount = 0;
+  uint8_t channelIndex = 0;
+  uint8_t type = 0;
+
+  digitCount = PrintSting("CH,\tFILTER,\tLEN\r\n", 0);
+  (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+
+  for ( channelIndex = 0; channelIndex < TOTAL_ADC_CHANNELS; channelIndex++) {
+    type = adcRead.filterBankARY[channelIndex].type;
+    if ( type >= ADC_FILTER_TYPES) {
+      type = ADC_FILTER_IIR;
+    }
+    digitCount = PrintUnsigned(channelIndex, 1);
+    digitCount = PrintSting(",\t", digitCount);
+    digitCount = PrintSting(filterStringsARY[type], digitCount);
+    digitCount = PrintSting(",\t", digitCount);
+    (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+
+    digitCount = PrintUnsigned(adcRead.filterBankARY[channelIndex].length, 1);
+    digitCount = PrintSting("\r\n", digitCount);
+    (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+  }
+}
+
+#ifdef ADCREAD_PLAUSIBILITY
+/*
+================================================================================
+Method name:  PrintSuppressed
+                    
+Originator:   
+
+Description: 
+  Print the number of implausible samples held for each chamber thermistor by
+  the plausibility check of the ADC read.
+
+  This method should be called using PrintSuppressed().
+
+Resources:
+  None
+
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+static void PrintSuppressed(void)
+{
+  uint8_t digitCount = 0;
+  uint8_t chamber = 0;
+
+  digitCount = PrintSting("CH,\tSUPP\r\n", 0);
+  (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+
+  for ( chamber = 0; chamber < ADC_CHAMBER_CHANNELS; chamber++) {
+    digitCount = PrintUnsigned(chamber + CHAMBER_TEMPERATURE1, 1);
+    digitCount = PrintSting(",\t", digitCount);
+    (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+
+    digitCount = PrintUnsigned(adcRead.suppressedCountARYW[chamber], 5);
+    digitCount = PrintSting("\r\n", digitCount);
+    (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+  }
+}
+#endif
+
+#ifdef SCHEDULER_LOAD_SHEDDING
+/*
+================================================================================
+Method name:  PrintShedStatus
+                    
+Originator:   
+
+Description: 
+  Print the present load shedding level of the scheduler, followed by the
+  number of entries and the number of skipped task calls of each level.
+
+  This method should be called using PrintShedStatus().
+
+Resources:
+  None
+
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+static void PrintShedStatus(void)
+{
+  uint8_t digitCount = 0;
+  uint8_t level = 0;
+
+  digitCount = PrintSting("SHED,\t", 0);
+  (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+  digitCount = PrintUnsigned(scheduler.shedLevel, 1);
+  digitCount = PrintSting("\r\n", digitCount);
+  (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+
+  for ( level = SCHEDULER_SHED_BACKGROUND; level < SCHEDULER_SHED_LEVELS; level++) {
+    digitCount = PrintSting("S", 0);
+    (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+    digitCount = PrintUnsigned(level, 1);
+    digitCount = PrintSting(",\tIN,\t", digitCount);
+    (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+
+    digitCount = PrintUnsigned(scheduler.shed[level].entriesW, 5);
+    digitCount = PrintSting(",\tSKIP,\t", digitCount);
+    (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+
+    digitCount = PrintUnsigned(scheduler.shed[level].skipsW, 5);
+    digitCount = PrintSting("\r\n", digitCount);
+    (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+  }
+}
+#endif
+
+#ifdef SCHEDULER_PROFILE
+/*
+================================================================================
+Method name:  PrintTaskProfile
+                    
+Originator:   
+
+Description: 
+  Print the execution time measured for the task by the scheduler. The number
+  of calls, minimum, average and maximum time in micro seconds are printed,
+  followed by the log2 histogram bins in TMR1 counts (0.533 us).
+
+  This method should be called using PrintTaskProfile().
+
+Resources:
+  None
+
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+static void PrintTaskProfile(uint8_t taskIndex)
+{
+  SchedulerProfile_STYP *profile = &scheduler.profile[taskIndex];
+  uint16_t averageW = 0;
+  uint8_t digitCount = 0;
+  uint8_t bin = 0;
+
+  if ( profile->countW != 0) {
+    averageW = (uint16_t) (profile->sumL / profile->countW);
+  }
+
+  digitCount = PrintSting("T", 0);
+  (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+  digitCount = PrintUnsigned(taskIndex, 2);
+  digitCount = PrintSting(",\t", digitCount);
+  (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+
+  digitCount = PrintUnsigned(profile->countW, 5);
+  digitCount = PrintSting(",\t", digitCount);
+  (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+
+  // Minimum, average and maximum in micro seconds
+  digitCount = PrintUnsigned(SERIAL_COUNTS_TO_US(profile->minW), 5);
+  digitCount = PrintSting(",\t", digitCount);
+  (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+
+  digitCount = PrintUnsigned(SERIAL_COUNTS_TO_US(averageW), 5);
+  digitCount = PrintSting(",\t", digitCount);
+  (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+
+  digitCount = PrintUnsigned(SERIAL_COUNTS_TO_US(profile->maxW), 5);
+  digitCount = PrintSting(",\t", digitCount);
+  (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+
+  for ( bin = 0; bin < SCHEDULER_PROFILE_BINS; bin++) {
+    digitCount = PrintUnsigned(profile->histogramARYW[bin], 5);
+    digitCount = PrintSting(" ", digitCount);
+    (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+  }
+
+  digitCount = PrintSting("\r\n", 0);
+  (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+}
+
+/*
+================================================================================
+Method name:  PrintTaskLateness
+                    
+Originator:   
+
+Description: 
+  Print the release lateness measured for the task by the scheduler. The worst
+  lateness since power ON in micro seconds is printed, followed by the log2
+  histogram bins in TMR1 counts (0.533 us).
+
+  This method should be called using PrintTaskLateness().
+
+Resources:
+  None
+
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+static void PrintTaskLateness(uint8_t taskIndex)
+{
+  SchedulerProfile_STYP *profile = &scheduler.profile[taskIndex];
+  uint8_t digitCount = 0;
+  uint8_t bin = 0;
+
+  digitCount = PrintSting("L", 0);
+  (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+  digitCount = PrintUnsigned(taskIndex, 2);
+  digitCount = PrintSting(",\t", digitCount);
+  (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+
+  digitCount = PrintUnsigned(SERIAL_COUNTS_TO_US(profile->latenessMaxW), 5);
+  digitCount = PrintSting(",\t", digitCount);
+  (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+
+  for ( bin = 0; bin < SCHEDULER_PROFILE_BINS; bin++) {
+    digitCount = PrintUnsigned(profile->latenessHistogramARYW[bin], 5);
+    digitCount = PrintSting(" ", digitCount);
+    (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+  }
+
+  digitCount = PrintSting("\r\n", 0);
+  (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+}
+
+#ifdef SCHEDULER_ISR_LANE
+/*
+================================================================================
+Method name:  PrintISRLaneProfile
+                    
+Originator:   
+
+Description: 
+  Print the longest execution time in micro seconds, the number of budget
+  over runs and the worst lateness from the tick in micro seconds of the ISR
+  lane task.
+
+  This method should be called using PrintISRLaneProfile().
+
+Resources:
+  None
+
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+2.6.0  10-16-2026  Worst lateness is printed.
+--------------------------------------------------------------------------------
+*/
+
+static void PrintISRLaneProfile(uint8_t laneIndex)
+{
+  uint8_t digitCount = 0;
+
+  digitCount = PrintSting("I", 0);
+  (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+  digitCount = PrintUnsigned(laneIndex, 2);
+  digitCount = PrintSting(",\tMAX,\t", digitCount);
+  (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+
+  digitCount = PrintUnsigned(SERIAL_COUNTS_TO_US(scheduler.isrLane[laneIndex].maxW), 5);
+  digitCount = PrintSting(",\tOVR,\t", digitCount);
+  (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+
+  digitCount = PrintUnsigned(scheduler.isrLane[laneIndex].overRunsW, 5);
+  digitCount = PrintSting(",\tLATE,\t", digitCount);
+  (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+
+  digitCount = PrintUnsigned(SERIAL_COUNTS_TO_US(scheduler.isrLane[laneIndex].latenessMaxW), 5);
+  digitCount = PrintSting("\r\n", digitCount);
+  (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+}
+#endif
+#endif
+
+
 /*
 ================================================================================
 Method name:  SerialDebugProcess
@@ -295,6 +715,19 @@ Resources:
                    added some more debug status prints.
 2.2.0  07-16-2020  Macro to disable the inlet temperature   Poorana kumar G
                    display in UART is disabled.
+2.6.0  10-16-2026  ?t command prints the task profile one
+                   task per call in place of the status,
+                   ?tr command clears the task profile.
+2.6.0  10-16-2026  ISR lane tasks are printed after the
+                   scheduled tasks.
+2.6.0  10-16-2026  ?l command prints the task lateness the
+                   same way as ?t command.
+2.6.0  10-16-2026  ?s command prints the load shedding
+                   counters.
+2.6.0  10-16-2026  Detected mask of the ADC read is used.
+2.6.0  10-16-2026  PID gains are loaded after a PID
+                   constant is changed.
+2.6.0  10-16-2026  ?a command selects the biquad filter.
 --------------------------------------------------------------------------------
 */
 
@@ -321,6 +754,31 @@ bool SerialDebugProcess(void)
           Serial.debugRxIndex = digitCount;
         }
       }
+#ifdef SCHEDULER_PROFILE
+      else if ( Serial.profileDumpCount != 0) {
+        // Print the profile of one task in place of the status
+        i = SERIAL_PROFILE_LINES - Serial.profileDumpCount;
+#ifdef SCHEDULER_ISR_LANE
+        if ( i >= scheduler.noOfTasks) {
+          PrintISRLaneProfile(i - scheduler.noOfTasks);
+        }
+        else if ( Serial.latenessDumpFLG) {
+          PrintTaskLateness(i);
+        }
+        else {
+          PrintTaskProfile(i);
+        }
+#else
+        if ( Serial.latenessDumpFLG) {
+          PrintTaskLateness(i);
+        }
+        else {
+          PrintTaskProfile(i);
+        }
+#endif
+        Serial.profileDumpCount--;
+      }
+#endif
       else {
         // Timestamp conversion and print
         digitCount = PrintInteger(Serial.debugTimeStampW, 5, 0);
@@ -359,7 +817,7 @@ bool SerialDebugProcess(void)
         (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
 
         // Chamber temperature - 1
-        if ( adcRead.flags.thermistor1DetectedFLG) {
+        if ( ADCREAD_DETECTED(CHAMBER_TEMPERATURE1)) {
           tempW = adcCountToTemperature(adcRead.adcDataARYW[CHAMBER_TEMPERATURE1]);
           digitCount = PrintInteger(tempW, 3, 0);
         }
@@ -370,7 +828,7 @@ bool SerialDebugProcess(void)
         (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
 
         // Chamber temperature - 2
-        if ( adcRead.flags.thermistor2DetectedFLG) {
+        if ( ADCREAD_DETECTED(CHAMBER_TEMPERATURE2)) {
           tempW = adcCountToTemperature(adcRead.adcDataARYW[CHAMBER_TEMPERATURE2]);
           digitCount = PrintInteger(tempW, 3, 0);
         }
@@ -381,7 +839,7 @@ bool SerialDebugProcess(void)
         (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
 
         // Chamber temperature - 3
-        if ( adcRead.flags.thermistor3DetectedFLG) {
+        if ( ADCREAD_DETECTED(CHAMBER_TEMPERATURE3)) {
           tempW = adcCountToTemperature(adcRead.adcDataARYW[CHAMBER_TEMPERATURE3]);
           digitCount = PrintInteger(tempW, 3, 0);
         }
@@ -392,7 +850,7 @@ bool SerialDebugProcess(void)
         (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
 
         // Chamber temperature - 4
-        if ( adcRead.flags.thermistor4DetectedFLG) {
+        if ( ADCREAD_DETECTED(CHAMBER_TEMPERATURE4)) {
           tempW = adcCountToTemperature(adcRead.adcDataARYW[CHAMBER_TEMPERATURE4]);
           digitCount = PrintInteger(tempW, 3, 0);
         }
@@ -411,6 +869,19 @@ bool SerialDebugProcess(void)
           digitCount = 0;
           while ( tempW < faultIndication.faultCount) {
             digitCount = PrintSting(errorStringsARY[faultIndication.faultsListARY[tempW]], digitCount);
+#ifdef SCHEDULER_TASK_WATCHDOG
+            // Index of the task missed its watchdog window, now or before
+            // the last reset
+            if ( faultIndication.faultsListARY[tempW] == TASK_WATCHDOG_ERROR) {
+              (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+              if ( scheduler.watchdogTask != SCHEDULER_NO_TASK) {
+                digitCount = PrintUnsigned(scheduler.watchdogTask, 2);
+              }
+              else {
+                digitCount = PrintUnsigned(scheduler.watchdogResetTask, 2);
+              }
+            }
+#endif
             digitCount = PrintSting(" ", digitCount);
 
             tempW++;
@@ -597,6 +1068,7 @@ bool SerialDebugProcess(void)
             nonVol.settings.pidConstantsARYF[data] = \
                     (float) atof((char *)&Serial.debugRxARY[beginSecNumber]);
             nonVol.write();
+            tempControl.LoadGains();
           }
           else if ( data >= START_OF_FLOW_PARAMETER){
               
@@ -646,8 +1118,94 @@ bool SerialDebugProcess(void)
 
         case ('z') :
         case ('Z') :
-          tempControl.integralF = 0.;
+          tempControl.integralL = 0;
+        break;
+
+#ifdef SCHEDULER_PROFILE
+        // ?t prints the execution time of the tasks, ?tr clears it
+        case ('t') :
+        case ('T') :
+          if ( (Serial.debugRxARY[2] == 'r') || (Serial.debugRxARY[2] == 'R')) {
+            scheduler.ResetProfile();
+          }
+          else {
+            digitCount = PrintSting("TASK,\tRUNS,\tMIN,\tAVG,\tMAX,\tLOG2 BINS\r\n", 0);
+            (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+            Serial.latenessDumpFLG = 0;
+            Serial.profileDumpCount = SERIAL_PROFILE_LINES;
+          }
+        break;
+
+        // ?l prints the worst release lateness and histogram of the tasks
+        case ('l') :
+        case ('L') :
+          digitCount = PrintSting("TASK,\tWORST,\tLOG2 BINS\r\n", 0);
+          (void) UART1_WriteBuffer(Serial.debugTxARY, digitCount);
+          Serial.latenessDumpFLG = 1;
+          Serial.profileDumpCount = SERIAL_PROFILE_LINES;
+        break;
+#endif
+
+        // ?a prints the filter of each ADC channel, ?acfn changes the filter
+        // of channel c to type f (i - IIR, a - average, m - median,
+        // b - biquad) of length n, e.g. ?a2m5 is the 5 point median for
+        // chamber 1
+        case ('a') :
+        case ('A') :
+          if ( Serial.debugRxARY[2] != 0) {
+            switch ( Serial.debugRxARY[3]) {
+              case ('i') :
+              case ('I') :
+                data = ADC_FILTER_IIR;
+              break;
+
+              case ('a') :
+              case ('A') :
+                data = ADC_FILTER_AVERAGE;
+              break;
+
+              case ('m') :
+              case ('M') :
+                data = ADC_FILTER_MEDIAN;
+              break;
+
+              case ('b') :
+              case ('B') :
+                data = ADC_FILTER_BIQUAD;
+              break;
+
+              default:
+                data = ADC_FILTER_TYPES;
+              break;
+            }
+            (void) adcRead.SetFilter((uint8_t)(Serial.debugRxARY[2] - '0'),
+                    (uint8_t)data, (uint8_t)(Serial.debugRxARY[4] - '0'));
+          }
+          PrintADCFilters();
+        break;
+
+#ifdef ADCREAD_PLAUSIBILITY
+        // ?c prints the suppressed chamber thermistor samples, ?cr clears them
+        case ('c') :
+        case ('C') :
+          if ( (Serial.debugRxARY[2] == 'r') || (Serial.debugRxARY[2] == 'R')) {
+            for ( i = 0; i < ADC_CHAMBER_CHANNELS; i++) {
+              adcRead.suppressedCountARYW[i] = 0;
+            }
+          }
+          else {
+            PrintSuppressed();
+          }
+        break;
+#endif
+
+#ifdef SCHEDULER_LOAD_SHEDDING
+        // ?s prints the load shedding level and counters
+        case ('s') :
+        case ('S') :
+          PrintShedStatus();
         break;
+#endif
 
         default:
         break;
@@ -49,6 +49,8 @@ IoTranslate requirements:
  History:	
 -*-----*-----------*------------------------------------*-----------------------
        10-10-2019  Initial Write                        Poorana kumar G
+2.6.0  10-16-2026  Task profile print count is added.
+2.6.0  10-16-2026  Task lateness print flag is added.
 --------------------------------------------------------------------------------
 */
 
@@ -86,6 +88,12 @@ typedef struct {
   uint8_t debugRxIndex;
   uint8_t debugTxARY[160];
   uint8_t debugRxARY[16];
+#ifdef SCHEDULER_PROFILE
+  // Number of task profiles still to be printed
+  uint8_t profileDumpCount;
+  // Print the task lateness in place of the execution time
+  bool latenessDumpFLG;
+#endif
 } SerialDebug_STYP;
 
 
@@ -105,6 +113,16 @@ typedef struct {
 #define FLOW_HYSTERESIS_OFFSET_PARAM    7   // flowHysteresisOffsetW parameter id number
 #define DRY_FIRE_THRESHOLD_PARAM        8   // dry fire threshold parameter id number
 
+// Scheduler timer counts (8 Tcy at 15 MIPS) to micro seconds
+#define SERIAL_COUNTS_TO_US(counts)     ((uint16_t)(((uint32_t)(counts) * 8) / 15))
+
+// Lines printed by ?t and ?l commands, scheduled tasks and then ISR lane tasks
+#ifdef SCHEDULER_ISR_LANE
+#define SERIAL_PROFILE_LINES            (scheduler.noOfTasks + SCHEDULER_ISR_LANE_TASKS)
+#else
+#define SERIAL_PROFILE_LINES            (scheduler.noOfTasks)
+#endif
+
 
 //  CLASS METHOD PROTOTYPES
 bool SerialDebugProcess(void);
@@ -0,0 +1,336 @@
+/*
+================================================================================
+File name:    PIDControl.h
+
+Originator:
+
+Platform:     dsPIC33EV64GM006
+Compiler:     XC16 V1.40
+IDE     :     MPLAB X IDE V5.20
+
+Description:
+  Fixed point control law of the PID calculation. The PID constants are
+  converted once to the gains in PID_GAIN_SHIFT fixed point and to the integer
+  limits, and every step is done in integers by the DSP PID step. The file
+  does not depend on the hardware, so the same code is built for the host test
+  in Test/, which compares it with the float calculation. DSPKernel.h uses its
+  portable C kernels on the host.
+
+Class Methods:
+  None
+
+Resources:
+  None
+================================================================================
+ History:
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write, moved out of
+                   TemperatureControl.c for the host test.
+2.6.0  10-16-2026  PID terms are summed by the DSP kernel.
+--------------------------------------------------------------------------------
+*/
+
+
+#ifndef _PIDCONTROL_H_
+#define _PIDCONTROL_H_
+
+#include <stdint.h>
+#include "DSPKernel.h"
+
+// Average slopes below and above 133F, used only for the PID gains. The
+// temperature conversions use the table generated by ThermistorTable.py. The
+// table is fitted to the two segment conversion these slopes come from, its
+// slopes over the same segments are 0.02328 and 0.03224, within 3%. So the
+// slopes are kept, the PID constants are tuned with them.
+#define DegPerADHalfUnitbelowMid    (0.023304f)
+#define DegPerADHalfUnitAbvoveMid   (0.033225f)
+
+#define DegPerADHalfUnit            ((DegPerADHalfUnitbelowMid + DegPerADHalfUnitAbvoveMid)/2)
+#define ADHalfUnitPerDeg            (1./DegPerADHalfUnit)
+
+#define ErrorLimitForKDToKickIn     (6 * ADHalfUnitPerDeg/2)
+#define eeIntegralLimit             106200L
+
+// Largest power cycle of the PID, Mode 8
+#define PID_MAX_POWER_CYCLE         120
+
+// Fixed point of the PID gains, the power is summed in 64 bits so the small
+// gains keep the resolution of the float constants
+#define PID_GAIN_SHIFT              24
+#define PID_GAIN_ONE                16777216.0f     // 1 << PID_GAIN_SHIFT
+
+// Terms of the PID step
+#define PID_TERM_P                  0
+#define PID_TERM_I                  1
+#define PID_TERM_D                  2       // KDI or KDD
+#define PID_TERM_PREBURN            3
+#define PID_TERM_DAMPING            4       // Preburn damping by the rate
+#define PID_TERMS                   5
+
+// ErrorLimitForKDToKickIn rounded up, the whole error is below both or none
+#define PID_KD_ERROR_LIMIT          ((int16_t) ErrorLimitForKDToKickIn +    \
+          ((((int16_t) ErrorLimitForKDToKickIn) < ErrorLimitForKDToKickIn) ? 1 : 0))
+
+// Gains and limits of the PID step
+typedef struct {
+  // PID constants in PID_GAIN_SHIFT fixed point
+  int32_t kpL;
+  int32_t kiL;
+  int32_t kdiL;
+  int32_t kddL;
+  int32_t preburnL;
+  // Integer limits, same as the float constants for the integer compared
+  int16_t hiErrThreshW;                 // Largest error x 2 not above
+  int16_t preburnRateW;                 // Smallest rate not below
+} PIDGains_STYP;
+
+#define PID_GAINS_DEFAULTS          {0, 0, 0, 0, 0, 0, 0}
+
+
+/*
+================================================================================
+Method name:  PIDGain
+
+Originator:
+
+Description:
+  The purpose of this function is to return the PID constant in PID_GAIN_SHIFT
+  fixed point, rounded to the nearest and saturated to 32 bits.
+
+  This method should be called using PIDGain().
+
+Resources:
+ None
+
+================================================================================
+ History:
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+ */
+
+static inline int32_t
+PIDGain (float constant)
+{
+  float scaled = constant * PID_GAIN_ONE;
+
+  if (scaled >= 2147483648.0f)
+    {
+      return INT32_MAX;
+    }
+  if (scaled <= -2147483648.0f)
+    {
+      return INT32_MIN;
+    }
+
+  return (int32_t) ((scaled >= 0.0f) ? (scaled + 0.5f) : (scaled - 0.5f));
+}
+
+/*
+================================================================================
+Method name:  PIDLimit
+
+Originator:
+
+Description:
+  The purpose of this function is to return the largest whole number not above
+  the PID constant, saturated to 16 bits. A whole number is above the constant
+  only if it is above this limit.
+
+  This method should be called using PIDLimit().
+
+Resources:
+ None
+
+================================================================================
+ History:
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+ */
+
+static inline int16_t
+PIDLimit (float constant)
+{
+  int16_t limitW;
+
+  if (constant >= 32767.0f)
+    {
+      return INT16_MAX;
+    }
+  if (constant <= -32768.0f)
+    {
+      return INT16_MIN;
+    }
+
+  limitW = (int16_t) constant;
+  // Cast is rounded towards zero
+  if ((float) limitW > constant)
+    {
+      limitW--;
+    }
+
+  return limitW;
+}
+
+/*
+================================================================================
+Method name:  PIDGainsLoad
+
+Originator:
+
+Description:
+  The purpose of this function is to convert the PID constants to the fixed
+  point gains and the integer limits of PIDStep(). The float library is used
+  only here, not in the control.
+
+  This method should be called using PIDGainsLoad().
+
+Resources:
+ None
+
+================================================================================
+ History:
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+ */
+
+static inline void
+PIDGainsLoad (PIDGains_STYP *gainsPTR, float kp, float ki, float kdi,
+        float kdd, float hiErrThresh, float preburnLimit)
+{
+  gainsPTR->kpL = PIDGain (kp);
+  gainsPTR->kiL = PIDGain (ki);
+  gainsPTR->kdiL = PIDGain (kdi);
+  gainsPTR->kddL = PIDGain (kdd);
+  gainsPTR->preburnL = PIDGain (preburnLimit);
+
+  // errorW * 2 > threshold
+  gainsPTR->hiErrThreshW = PIDLimit (hiErrThresh);
+  // Rate < limit is rate < the limit rounded up, one more than the largest
+  // whole number below it
+  gainsPTR->preburnRateW = PIDLimit (-preburnLimit);
+  if (gainsPTR->preburnRateW != INT16_MIN)
+    {
+      gainsPTR->preburnRateW = -gainsPTR->preburnRateW;
+    }
+  else
+    {
+      gainsPTR->preburnRateW = INT16_MAX;
+    }
+}
+
+/*
+================================================================================
+Method name:  PIDStep
+
+Originator:   Poorana kumar G
+
+Description:
+  The purpose of this function is to return the power cycle of one PID step
+  from the target and the outlet temperature in ADC half units and the rate of
+  the outlet temperature. The integral is updated.
+
+  The power is summed in 64 bits by the DSP PID step, so no float library is
+  called. The integral is a whole number, and the error and the rate are
+  compared with the integer limits, so the control law is the same as with the
+  float constants. The terms are doubled, so the half rate of the derivative
+  terms is whole.
+
+  This method should be called using PIDStep().
+
+Resources:
+ None
+
+================================================================================
+ History:
+-*-----*-----------*------------------------------------*-----------------------
+       10-09-2019  Initial Write                        Poorana kumar G
+2.6.0  10-16-2026  Fixed point gains and integral replace
+                   the float calculation.
+2.6.0  10-16-2026  Moved from PIDCalculation.
+2.6.0  10-16-2026  Terms are summed by the DSP PID step.
+--------------------------------------------------------------------------------
+ */
+
+static inline uint8_t
+PIDStep (const PIDGains_STYP *gainsPTR, int32_t *integralPTRL,
+        int16_t targetW, int16_t outletW, int16_t rateW)
+{
+  int64_t powerLL = 0;
+  int16_t errorW = 0;
+  // Gains and the doubled terms, a gain of 0 leaves the term out
+  int32_t gainARYL[PID_TERMS] = {0, 0, 0, 0, 0};
+  int32_t termARYL[PID_TERMS];
+
+  errorW = (targetW - outletW) / 2;
+  *integralPTRL = *integralPTRL + errorW;
+
+  // Limit the integral
+  if (*integralPTRL > eeIntegralLimit)
+    {
+      *integralPTRL = eeIntegralLimit;
+    }
+  if (*integralPTRL < 0)
+    {
+      *integralPTRL = 0;
+    }
+
+  // 'P' Term and 'I' Term
+  gainARYL[PID_TERM_P] = gainsPTR->kpL;
+  termARYL[PID_TERM_P] = (int32_t) errorW * 2;
+  gainARYL[PID_TERM_I] = gainsPTR->kiL;
+  termARYL[PID_TERM_I] = *integralPTRL * 2;
+
+  // If target temperature is near reduce the power cycle based on rate of
+  // change of outlet temperature
+  termARYL[PID_TERM_D] = -rateW;
+  if (errorW < PID_KD_ERROR_LIMIT)
+    {
+      if (rateW > 0)
+        {
+          gainARYL[PID_TERM_D] = gainsPTR->kdiL;
+        }
+      else
+        {
+          gainARYL[PID_TERM_D] = gainsPTR->kddL;
+        }
+    }
+
+  // This is the preburn, dump in a bunch of power
+  // If so cold its below hi_err_thresh AND not increasing "enough"
+  termARYL[PID_TERM_PREBURN] = (int32_t) errorW * 2;
+  if ((errorW * 2 > gainsPTR->hiErrThreshW) &&                             \
+          (rateW < gainsPTR->preburnRateW))
+    {
+      gainARYL[PID_TERM_PREBURN] = gainsPTR->preburnL;
+    }
+
+  //If so cold its below hi_err_thresh, back off proportional to the rate,
+  // basically more damping,
+  termARYL[PID_TERM_DAMPING] = -rateW;
+  if ((errorW * 2) > gainsPTR->hiErrThreshW)
+    {
+      gainARYL[PID_TERM_DAMPING] = gainsPTR->preburnL;
+    }
+
+  // Twice the power
+  powerLL = DSPPIDStep (gainARYL, termARYL, PID_TERMS);
+
+  // Limit the power
+  if (powerLL > ((int64_t) PID_MAX_POWER_CYCLE << (PID_GAIN_SHIFT + 1)))
+    {
+      powerLL = (int64_t) PID_MAX_POWER_CYCLE << (PID_GAIN_SHIFT + 1);
+    }
+
+  // Limit the power
+  if (powerLL < 0)
+    {
+      powerLL = 0;
+    }
+
+  return (uint8_t) (powerLL >> (PID_GAIN_SHIFT + 1));
+}
+
+#endif /*_PIDCONTROL_H_*/
@@ -24,6 +24,10 @@ Class Methods:
     Called when the the relay control status is "RELAY_CONTROL_CONTROL" to
     calculate the power cycle to be applied to the opto coupler.
 
+  void PIDLoadGains(void);
+    Converts the PID constants of the settings to the fixed point gains used
+    by PIDCalculation().
+
 Method Calling Requirements:
   tempControl.Control() should be called once per 500 millisecond in
   scheduler.
@@ -48,10 +52,23 @@ IoTranslate requirements:
        11-04-2019  PC-Lint warnings are cleared.        Poorana kumar G
 1.1.0  01-30-2020  As per the Beta requirement changes  Poorana kumar G
                    updated the functions
+2.6.0  10-16-2026  Temperature conversions use the
+                   generated thermistor table.
+2.6.0  10-16-2026  Temperature raise and outlet derivative
+                   are taken from the ADC sample slope.
+2.6.0  10-16-2026  Detected chamber thermistors and their
+                   errors are taken from the ADC read.
+2.6.0  10-16-2026  Temperatures are the lag compensated
+                   thermistor data.
+2.6.0  10-16-2026  PID calculation is done in fixed point
+                   by the step of PIDControl.h.
+2.6.0  10-16-2026  Control steps once per interval on the
+                   scan complete events.
 --------------------------------------------------------------------------------
  */
 
 #include "TemperatureControl.h"
+#include "ThermistorTable.h"
 
 /*
 ================================================================================
@@ -73,6 +90,7 @@ Resources:
  History:	
 -*-----*-----------*------------------------------------*-----------------------
        09-14-2020  Initial Write                        Poorana kumar G
+2.6.0  10-16-2026  Detected mask of the ADC read is used.
 --------------------------------------------------------------------------------
  */
 
@@ -82,28 +100,28 @@ isAnyChamberTempAboveTarget (void)
   bool retVal = false;
 
   // Check that chamber 1 temperature is above target
-  if ((adcRead.flags.thermistor1DetectedFLG == true) &&        \
+  if (ADCREAD_DETECTED (CHAMBER_TEMPERATURE1) &&        \
           (tempControl.temperatureARYW[CHAMBER_TEMPERATURE1] >= tempControl.targetADCHalfUnitsW))
     {
       retVal = true;
     }
 
   // Check that chamber 2 temperature is above target
-  if ((adcRead.flags.thermistor2DetectedFLG == true) &&        \
+  if (ADCREAD_DETECTED (CHAMBER_TEMPERATURE2) &&        \
           (tempControl.temperatureARYW[CHAMBER_TEMPERATURE2] >= tempControl.targetADCHalfUnitsW))
     {
       retVal = true;
     }
 
   // Check that chamber 3 temperature is above target
-  if ((adcRead.flags.thermistor3DetectedFLG == true) &&        \
+  if (ADCREAD_DETECTED (CHAMBER_TEMPERATURE3) &&        \
           (tempControl.temperatureARYW[CHAMBER_TEMPERATURE3] >= tempControl.targetADCHalfUnitsW))
     {
       retVal = true;
     }
 
   // Check that chamber 4 temperature is above target
-  if ((adcRead.flags.thermistor4DetectedFLG == true) &&        \
+  if (ADCREAD_DETECTED (CHAMBER_TEMPERATURE4) &&        \
           (tempControl.temperatureARYW[CHAMBER_TEMPERATURE4] >= tempControl.targetADCHalfUnitsW))
     {
       retVal = true;
@@ -132,6 +150,7 @@ Resources:
  History:	
 -*-----*-----------*------------------------------------*-----------------------
        09-14-2020  Initial Write                        Poorana kumar G
+2.6.0  10-16-2026  Detected mask of the ADC read is used.
 --------------------------------------------------------------------------------
  */
 
@@ -141,28 +160,28 @@ checkDryFireEvent (void)
   bool retVal = false;
 
   // Check the chamber 1 temperature rise
-  if ((adcRead.flags.thermistor1DetectedFLG == true) &&        \
+  if (ADCREAD_DETECTED (CHAMBER_TEMPERATURE1) &&        \
           (Chamber1Rise >= tempControl.dryFireThresholdW))
     {
       retVal = true;
     }
 
   // Check the chamber 2 temperature rise
-  if ((adcRead.flags.thermistor2DetectedFLG == true) &&        \
+  if (ADCREAD_DETECTED (CHAMBER_TEMPERATURE2) &&        \
           (Chamber2Rise >= tempControl.dryFireThresholdW))
     {
       retVal = true;
     }
 
   // Check the chamber 3 temperature rise
-  if ((adcRead.flags.thermistor3DetectedFLG == true) &&        \
+  if (ADCREAD_DETECTED (CHAMBER_TEMPERATURE3) &&        \
           (Chamber3Rise >= tempControl.dryFireThresholdW))
     {
       retVal = true;
     }
 
   // Check the chamber 4 temperature rise
-  if ((adcRead.flags.thermistor4DetectedFLG == true) &&        \
+  if (ADCREAD_DETECTED (CHAMBER_TEMPERATURE4) &&        \
           (Chamber4Rise >= tempControl.dryFireThresholdW))
     {
       retVal = true;
@@ -182,6 +201,13 @@ Description:
   inlet and outlet temperature based on the thermistor analog data and flow
   detection using PID algorithm.
 
+  When SCHEDULER_EVENT_TRIGGER is defined, it is called on every ADC scan
+  complete event and steps on the first scan completed after the step is due,
+  so the over heat, shut down and reverse flow checks and the PID use the scan
+  just completed. The due tick is advanced by 500 msec from the previous due
+  tick, so the average step interval stays 500 msec and each step is late by
+  one scan period at most.
+
   This method should be called using tempControl.Control().
 
 Resources:
@@ -208,6 +234,18 @@ Resources:
                    are added.
                    Relay shut down time changed from 5 mins 
                    to 30 seconds to save power.
+2.6.0  10-16-2026  Called on the ADC scan complete event.
+2.6.0  10-16-2026  Temperature raise and outlet derivative
+                   are the least squares slope of the ADC
+                   samples.
+2.6.0  10-16-2026  Open error of the chamber thermistor is
+                   taken from the channel descriptor.
+2.6.0  10-16-2026  Temperatures are the lag compensated
+                   thermistor data, the over heat check
+                   stays on the filtered data.
+2.6.0  10-16-2026  Integral is cleared as an integer.
+2.6.0  10-16-2026  Steps once per interval on the scan
+                   complete events.
 --------------------------------------------------------------------------------
  */
 
@@ -216,16 +254,32 @@ TemperatureControl (void)
 {
   uint8_t i = 0;
 
+#ifdef SCHEDULER_EVENT_TRIGGER
+  // Scans complete more often than the control interval, wait for the step
+  if ((int16_t) (scheduler.tickCountW - tempControl.stepDueTickW) < 0)
+    {
+      return TASK_COMPLETED;
+    }
+
+  tempControl.stepDueTickW += TEMPERATURE_CONTROL_INTERVAL;
+  // Start a new time base after the first step or a stall of the scans
+  if ((int16_t) (scheduler.tickCountW - tempControl.stepDueTickW) >= 0)
+    {
+      tempControl.stepDueTickW = scheduler.tickCountW +                     \
+              TEMPERATURE_CONTROL_INTERVAL;
+    }
+#endif
+
   // Loop through i-0 to 5
   for (i = INLET_TEMPERATURE; i <= CHAMBER_TEMPERATURE4; i++)
     {
       tempControl.temperature2backARYW[i] = tempControl.temperaturePrevARYW[i];
       tempControl.temperaturePrevARYW[i] = tempControl.temperatureARYW[i];
-      tempControl.temperatureARYW[i] = adcRead.adcDataARYW[i];
+      tempControl.temperatureARYW[i] = adcRead.compensatedARYW[i];
 
-      // Calculate the temperature raise in past 1 second
-      tempControl.dtOfAverageARYW[i] = (tempControl.temperatureARYW[i] -   \
-            tempControl.temperature2backARYW[i]) / 2;
+      // Calculate the temperature raise per 500 ms over the past 1 second
+      tempControl.dtOfAverageARYW[i] =                                      \
+              adcRead.Slope(i, TEMPERATURE_RISE_WINDOW) / 2;
 
       // Reset the temperature raise if any error in thermistor
       if ((tempControl.temperature2backARYW[i] < THERMISTOR_OPEN_ADC_COUNT) || \
@@ -238,38 +292,39 @@ TemperatureControl (void)
   // Calculate the change in outlet temperature
   tempControl.outletTemperaturePrevW = tempControl.outletTemperatureW;
   tempControl.outletTemperatureW = Tout;
+  // Change in 500 ms by the slope over the past 500 ms
   tempControl.dtOutletTemperatureW =                                        \
-          tempControl.outletTemperatureW - tempControl.outletTemperaturePrevW;
+          adcRead.Slope(OUTLET_TEMPERATURE, TEMPERATURE_DERIVATIVE_WINDOW) / 2;
 
   // Check the any connected thermistor's temperature is above too hot limit
-  if ((adcRead.flags.thermistor1DetectedFLG == true) &&                                        \
+  if (ADCREAD_DETECTED (CHAMBER_TEMPERATURE1) &&                                        \
           (adcRead.adcDataARYW[CHAMBER_TEMPERATURE1] < THERMISTOR_SHORT_ADC_COUNT) &&          \
           (adcRead.adcDataARYW[CHAMBER_TEMPERATURE1] > tempControl.overHeatADCHalfUnits) &&    \
-          (faultIndication.errorExists (THERMISTOR3_OPEN_ERROR) == false))
+          (faultIndication.errorExists (adcChannelARY[CHAMBER_TEMPERATURE1].lowError) == false))
     {
       faultIndication.Error (OVER_HEAT_ERROR);
       tempControl.flags.thermistor1OverHeatFLG = true;
     }
-  else if ((adcRead.flags.thermistor2DetectedFLG == true) &&                                   \
+  else if (ADCREAD_DETECTED (CHAMBER_TEMPERATURE2) &&                                   \
           (adcRead.adcDataARYW[CHAMBER_TEMPERATURE2] < THERMISTOR_SHORT_ADC_COUNT) &&          \
           (adcRead.adcDataARYW[CHAMBER_TEMPERATURE2] > tempControl.overHeatADCHalfUnits) &&    \
-          (faultIndication.errorExists (THERMISTOR4_OPEN_ERROR) == false))
+          (faultIndication.errorExists (adcChannelARY[CHAMBER_TEMPERATURE2].lowError) == false))
     {
       faultIndication.Error (OVER_HEAT_ERROR);
       tempControl.flags.thermistor2OverHeatFLG = true;
     }
-  else if ((adcRead.flags.thermistor3DetectedFLG == true) &&                                   \
+  else if (ADCREAD_DETECTED (CHAMBER_TEMPERATURE3) &&                                   \
           (adcRead.adcDataARYW[CHAMBER_TEMPERATURE3] < THERMISTOR_SHORT_ADC_COUNT) &&          \
           (adcRead.adcDataARYW[CHAMBER_TEMPERATURE3] > tempControl.overHeatADCHalfUnits) &&    \
-          (faultIndication.errorExists (THERMISTOR5_OPEN_ERROR) == false))
+          (faultIndication.errorExists (adcChannelARY[CHAMBER_TEMPERATURE3].lowError) == false))
     {
       faultIndication.Error (OVER_HEAT_ERROR);
       tempControl.flags.thermistor3OverHeatFLG = true;
     }
-  else if ((adcRead.flags.thermistor4DetectedFLG == true) &&                                   \
+  else if (ADCREAD_DETECTED (CHAMBER_TEMPERATURE4) &&                                   \
           (adcRead.adcDataARYW[CHAMBER_TEMPERATURE4] < THERMISTOR_SHORT_ADC_COUNT) &&          \
           (adcRead.adcDataARYW[CHAMBER_TEMPERATURE4] > tempControl.overHeatADCHalfUnits) &&    \
-          (faultIndication.errorExists (THERMISTOR6_OPEN_ERROR) == false))
+          (faultIndication.errorExists (adcChannelARY[CHAMBER_TEMPERATURE4].lowError) == false))
     {
       faultIndication.Error (OVER_HEAT_ERROR);
       tempControl.flags.thermistor4OverHeatFLG = true;
@@ -761,7 +816,7 @@ TemperatureControl (void)
     default:
       // Keep the Opto-coupler in OFF state
       optoCouplerControl.powerCycle = POWER_CYCLE_OFF;
-      tempControl.integralF = 0.0f;
+      tempControl.integralL = 0;
       break;
     }
 
@@ -778,6 +833,8 @@ Description:
   Called when the the relay control status is "RELAY_CONTROL_CONTROL" to
   calculate the power cycle to be applied to the opto coupler.
 
+  The fixed point step is done by PIDStep() of PIDControl.h.
+
   This method should be called using tempControl.PIDCalculation().
 
 Resources:
@@ -787,74 +844,48 @@ Resources:
  History:	
 -*-----*-----------*------------------------------------*-----------------------
        10-09-2019  Initial Write                        Poorana kumar G
+2.6.0  10-16-2026  Fixed point step of PIDControl.h
+                   replaces the float calculation.
 --------------------------------------------------------------------------------
  */
 
 void
 PIDCalculation (void)
 {
-  float fpower = 0.0f;
-  int16_t errorW = 0;
-
-  errorW = (tempControl.targetADCHalfUnitsW - tempControl.outletTemperatureW) / 2;
-  tempControl.integralF = tempControl.integralF + errorW;
-
-  // Limit the integral
-  if (tempControl.integralF > eeIntegralLimit)
-    {
-      tempControl.integralF = eeIntegralLimit;
-    }
-  if (tempControl.integralF < 0.0f)
-    {
-      tempControl.integralF = 0.0f;
-    }
-
-  // 'P' Term and 'I' Term
-  fpower = (PID_CONST_KP * errorW) + (PID_CONST_KI * tempControl.integralF);
+  optoCouplerControl.powerCycle = PIDStep (&tempControl.pidGains,           \
+          &tempControl.integralL, tempControl.targetADCHalfUnitsW,          \
+          tempControl.outletTemperatureW, tempControl.dtOutletTemperatureW);
+}
 
-  // If target temperature is near reduce the power cycle based on rate of
-  // change of outlet temperature
-  if (errorW < ErrorLimitForKDToKickIn)
-    {
-      if (tempControl.dtOutletTemperatureW > 0)
-        {
-          fpower = fpower - (PID_CONST_KDI * tempControl.dtOutletTemperatureW / 2);
-        }
-      else
-        {
-          fpower = fpower - (PID_CONST_KDD * tempControl.dtOutletTemperatureW / 2);
-        }
-    }
+/*
+================================================================================
+Method name:  PIDLoadGains
+                    
+Originator:   
 
-  // This is the preburn, dump in a bunch of power
-  // If so cold its below hi_err_thresh AND not increasing "enough"
-  if ((errorW * 2 > PID_CONST_HI_ERR_THRESH) &&                            \
-          (tempControl.dtOutletTemperatureW < PID_CONST_PREBURN_LIMIT))
-    {
-      fpower = fpower + (PID_CONST_PREBURN_LIMIT * errorW);
-    }
+Description: 
+  The purpose of this function is to convert the PID constants of the settings
+  to the fixed point gains and the integer limits of PIDCalculation().
 
-  //If so cold its below hi_err_thresh, back off proportional to the rate,
-  // basically more damping,
-  if ((errorW * 2) > PID_CONST_HI_ERR_THRESH)
-    {
-      fpower = fpower -                                                       \
-            (PID_CONST_PREBURN_LIMIT * tempControl.dtOutletTemperatureW / 2);
-    }
+  This method should be called using tempControl.LoadGains() after the settings
+  are read or changed.
 
-  // Limit the power
-  if (fpower > MAXPOWER_POWER_CYCLE)
-    {
-      fpower = MAXPOWER_POWER_CYCLE;
-    }
+Resources:
+ None
 
-  // Limit the power
-  if (fpower < 0.0f)
-    {
-      fpower = 0;
-    }
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+ */
 
-  optoCouplerControl.powerCycle = (unsigned char) fpower;
+void
+PIDLoadGains (void)
+{
+  PIDGainsLoad (&tempControl.pidGains, PID_CONST_KP, PID_CONST_KI,
+          PID_CONST_KDI, PID_CONST_KDD, PID_CONST_HI_ERR_THRESH,
+          PID_CONST_PREBURN_LIMIT);
 }
 
 /*
@@ -865,7 +896,10 @@ Originator:   Poorana kumar G
 
 Description: 
   The purpose of this function is to convert the ADC count into its equivalent
-  temperature.
+  temperature. The knots around the count are found by binary search in the
+  thermistor table and the temperature is linearly interpolated between them,
+  rounded to the nearest degree. Counts out of the table are clamped to the
+  first and last temperature of the table.
 
   This method should be called using adcCountToTemperature().
 
@@ -876,20 +910,52 @@ Resources:
  History:	
 -*-----*-----------*------------------------------------*-----------------------
        05-11-2020  Initial Write                        Poorana kumar G
+2.6.0  10-16-2026  Integer interpolation in the thermistor
+                   table.
 --------------------------------------------------------------------------------
  */
 
 uint16_t
 adcCountToTemperature (uint16_t adcCount)
 {
-  if (adcCount <= ADC_COUNT_MIDPOINT)
+  uint8_t lowIndex = 0;
+  uint8_t highIndex = THERMISTOR_TABLE_SIZE - 1;
+  uint8_t midIndex;
+  uint16_t spanW;
+  uint16_t temperature;
+
+  if (adcCount <= thermistorTableARYW[lowIndex])
+    {
+      temperature = THERMISTOR_TABLE_FIRST_TEMPERATURE;
+    }
+  else if (adcCount >= thermistorTableARYW[highIndex])
     {
-      return (uint16_t) ((adcCount * DegPerADHalfUnitbelowMid) + DegAt0VoltbelowMid);
+      temperature = THERMISTOR_TABLE_LAST_TEMPERATURE;
     }
   else
     {
-      return (uint16_t) (((adcCount - ADC_COUNT_MIDPOINT) * DegPerADHalfUnitAbvoveMid) + DegAt0VoltAbvoveMid);
+      // Find the knots with table[lowIndex] <= adcCount < table[highIndex]
+      while ((highIndex - lowIndex) > 1)
+        {
+          midIndex = (uint8_t) ((lowIndex + highIndex) / 2);
+          if (adcCount < thermistorTableARYW[midIndex])
+            {
+              highIndex = midIndex;
+            }
+          else
+            {
+              lowIndex = midIndex;
+            }
+        }
+
+      spanW = thermistorTableARYW[highIndex] - thermistorTableARYW[lowIndex];
+      temperature = THERMISTOR_TABLE_FIRST_TEMPERATURE +
+              ((uint16_t) lowIndex * THERMISTOR_TABLE_STEP) +
+              ((((adcCount - thermistorTableARYW[lowIndex]) *
+                 THERMISTOR_TABLE_STEP) + (spanW / 2)) / spanW);
     }
+
+  return temperature;
 }
 
 /*
@@ -900,9 +966,12 @@ Originator:   Poorana kumar G
 
 Description: 
   The purpose of this function is to convert the temperature into its equivalent
-  ADC count.
+  ADC count. The count is linearly interpolated between the knots of the
+  thermistor table, so it is the inverse of adcCountToTemperature() and exact
+  at the knots. Temperatures out of the table are clamped to the first and last
+  count of the table.
 
-  This method should be called using adcCountToTemperature().
+  This method should be called using temperatureToADCCount().
 
 Resources:
  None
@@ -911,20 +980,39 @@ Resources:
  History:	
 -*-----*-----------*------------------------------------*-----------------------
        05-11-2020  Initial Write                        Poorana kumar G
+2.6.0  10-16-2026  Integer interpolation in the thermistor
+                   table.
 --------------------------------------------------------------------------------
  */
 
 uint16_t
 temperatureToADCCount (uint16_t temperature)
 {
-  if (temperature <= TEMPERATURE_MIDPOINT)
+  uint8_t index;
+  uint16_t offset;
+  uint16_t adcCount;
+
+  if (temperature <= THERMISTOR_TABLE_FIRST_TEMPERATURE)
     {
-      return (uint16_t) ((temperature - DegAt0VoltbelowMid) / DegPerADHalfUnitbelowMid);
+      adcCount = thermistorTableARYW[0];
+    }
+  else if (temperature >= THERMISTOR_TABLE_LAST_TEMPERATURE)
+    {
+      adcCount = thermistorTableARYW[THERMISTOR_TABLE_SIZE - 1];
     }
   else
     {
-      return (uint16_t) ((temperature + DegAbvoveMidTempConst) / DegPerADHalfUnitAbvoveMid);
+      offset = temperature - THERMISTOR_TABLE_FIRST_TEMPERATURE;
+      index = (uint8_t) (offset / THERMISTOR_TABLE_STEP);
+      offset -= (uint16_t) index * THERMISTOR_TABLE_STEP;
+
+      adcCount = thermistorTableARYW[index] +
+              (((offset * (thermistorTableARYW[index + 1] -
+                           thermistorTableARYW[index])) +
+                (THERMISTOR_TABLE_STEP / 2)) / THERMISTOR_TABLE_STEP);
     }
+
+  return adcCount;
 }
 
 
@@ -24,6 +24,10 @@ Class Methods:
     Called when the the relay control status is "RELAY_CONTROL_CONTROL" to
     calculate the power cycle to be applied to the opto coupler.
 
+  void PIDLoadGains(void);
+    Converts the PID constants of the settings to the fixed point gains used
+    by PIDCalculation().
+
 Method Calling Requirements:
   tempControl.Control() should be called once per 500 millisecond in
   scheduler.
@@ -41,6 +45,15 @@ IoTranslate requirements:
  History:	
 -*-----*-----------*------------------------------------*-----------------------
        10-03-2019  Initial Write                        Poorana kumar G
+2.6.0  10-16-2026  Two segment temperature conversion
+                   constants are replaced by the generated
+                   thermistor table.
+2.6.0  10-16-2026  Slope windows of the temperature raise
+                   and outlet derivative are added.
+2.6.0  10-16-2026  PID integral and gains are fixed point.
+2.6.0  10-16-2026  PID gains and macros are moved to
+                   PIDControl.h.
+2.6.0  10-16-2026  Due tick of the control step is added.
 --------------------------------------------------------------------------------
 */
 
@@ -54,6 +67,7 @@ IoTranslate requirements:
 #include "FlowDetector.h"
 #include "OptoCouplerControl.h"
 #include "FaultIndication.h"
+#include "PIDControl.h"
 
 // Enums for Relay control status
 typedef enum {
@@ -97,6 +111,8 @@ typedef struct {
 
 // Public Methods
   bool (*Control)(void);
+  // Load the PID gains after the settings are read or changed
+  void (*LoadGains)(void);
 
 // Private Variables
   int16_t temperature2backARYW[TOTAL_THERMISTORS];
@@ -112,8 +128,12 @@ typedef struct {
   uint16_t shutDownCounterW;
   uint16_t errorWaitCounterW;
   int16_t dryFireThresholdW;
-  float integralF;
+  int32_t integralL;                    // Sum of the errors
+  PIDGains_STYP pidGains;
   void (*PIDFunction)(void);
+#ifdef SCHEDULER_EVENT_TRIGGER
+  uint16_t stepDueTickW;                // Tick count the next step is due
+#endif
 } TemperatureControl_STYP;
 
 
@@ -126,6 +146,7 @@ typedef struct {
                                         0,                          \
                                         0,                          \
                                         &TemperatureControl,        \
+                                        &PIDLoadGains,              \
                                         {0,0,0,0,0,0},              \
                                         {0,0,0,0,0,0},              \
                                         {THERMISTOR_OPEN_ADC_COUNT, \
@@ -142,19 +163,24 @@ typedef struct {
                                         0,                          \
                                         0,                          \
                                         DRY_FIRE_THRESHOLD_DEFAULT, \
-                                        0.0,                        \
+                                        0,                          \
+                                        PID_GAINS_DEFAULTS,         \
                                         &PIDCalculation,            \
                                      }
 
 #define SHUT_DOWN_TIMEOUT           60                      // 5 Minutes // 30 seconds post v2.3.0 changes
 #define ERROR_WAIT_TIME             60                      // 30 seconds
-#define MAXPOWER_POWER_CYCLE        120                     // Mode 8
+#define MAXPOWER_POWER_CYCLE        PID_MAX_POWER_CYCLE     // Mode 8
 #define STANDBY_POWER_CYCLE         MAXPOWER_POWER_CYCLE    // Maximum
 #define POWER_CYCLE_OFF             0                       // OFF
 #define STANDBY_OFFSET              10                      // From set point
 
 #define OVER_HEAT_TEMPERATURE       200                     // 200F            // value changed as per Mike Jan Updates from 190F to 200F 
 
+// Windows in ms of the ADC sample slope
+#define TEMPERATURE_RISE_WINDOW         1000
+#define TEMPERATURE_DERIVATIVE_WINDOW   500
+
 #define Tin                         tempControl.temperatureARYW[0]
 #define Tout                        tempControl.temperatureARYW[1]
 #define TinRise                     tempControl.dtOfAverageARYW[0]
@@ -164,25 +190,6 @@ typedef struct {
 #define Chamber3Rise                tempControl.dtOfAverageARYW[4]
 #define Chamber4Rise                tempControl.dtOfAverageARYW[5]
 
-#define ADC_COUNT_MIDPOINT          5362        // ADC Half units for mid point
-#define TEMPERATURE_MIDPOINT        133         // in F
-
-#define DegAt0VoltbelowMid          8.8f        // In F
-#define DegPerADHalfUnitbelowMid    (0.023304f)
-
-#define DegAt0VoltAbvoveMid         133.75f      // In F
-//#define DegPerADHalfUnitAbvoveMid   (0.040418f)
-//#define DegAbvoveMidTempConst       83.01f
-#define DegPerADHalfUnitAbvoveMid   (0.033225f)     // values changed because mike reported that display shows 190 F but actual was 180F
-#define DegAbvoveMidTempConst       44.4f
-
-//#define DegAt0Volt                  10.6f               // In F
-#define DegPerADHalfUnit            ((DegPerADHalfUnitbelowMid + DegPerADHalfUnitAbvoveMid)/2)
-#define ADHalfUnitPerDeg            (1./DegPerADHalfUnit)
-
-#define ErrorLimitForKDToKickIn     (6 * ADHalfUnitPerDeg/2)
-#define eeIntegralLimit             106200.0f
-
 #define TDiffForShutDown                    (0)
 #define TinMinimumRiseLimitForSignificant   (64)
 #define ToutMaximumRiseLimitForSignificant  (24)
@@ -201,6 +208,7 @@ typedef struct {
 
 bool TemperatureControl(void);
 void PIDCalculation(void);
+void PIDLoadGains(void);
 uint16_t adcCountToTemperature(uint16_t adcCount);
 uint16_t temperatureToADCCount(uint16_t temperature);
 
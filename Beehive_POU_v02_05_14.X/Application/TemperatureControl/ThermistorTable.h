@@ -0,0 +1,71 @@
+/*
+================================================================================
+File name:    ThermistorTable.h
+
+Description:
+  Generated by ThermistorTable.py, do not edit. ADC half units of the
+  thermistor at every 5 deg F from 30 deg F, Steinhart-Hart curve fitted to
+  the calibrated conversion of v2.5.14. It is within +2.5 deg F of it from 900
+  to 7506 half units and within +1.3 deg F from 5851, 150 deg F.
+  Included only by TemperatureControl.c.
+
+    A = 3.198119405e-03, B = 2.786243489e-04, C = -1.295328074e-05
+
+  Counts used by the firmware:
+   900   32 deg F, calibrated  29.8 deg F, THERMISTOR_OPEN_ADC_COUNT
+  3913   99 deg F, calibrated 100.0 deg F, DRY_FIRE_THRESHOLD_DEFAULT, 100 deg F
+  5362  136 deg F, calibrated 133.8 deg F, calibration mid point
+  7372  201 deg F, calibrated 200.5 deg F, over heat, 200 deg F
+  7506  205 deg F, calibrated 205.0 deg F, THERMISTOR_SHORT_ADC_COUNT, 205 deg F
+================================================================================
+*/
+
+#ifndef _THERMISTORTABLE_H
+#define _THERMISTORTABLE_H
+
+#define THERMISTOR_TABLE_FIRST_TEMPERATURE  30
+#define THERMISTOR_TABLE_LAST_TEMPERATURE   205
+#define THERMISTOR_TABLE_STEP               5
+#define THERMISTOR_TABLE_SIZE               36
+
+static const uint16_t thermistorTableARYW[THERMISTOR_TABLE_SIZE] =
+{
+   794,     //  30 deg F
+  1065,     //  35 deg F
+  1302,     //  40 deg F
+  1531,     //  45 deg F
+  1756,     //  50 deg F
+  1980,     //  55 deg F
+  2204,     //  60 deg F
+  2427,     //  65 deg F
+  2651,     //  70 deg F
+  2874,     //  75 deg F
+  3096,     //  80 deg F
+  3316,     //  85 deg F
+  3535,     //  90 deg F
+  3751,     //  95 deg F
+  3963,     // 100 deg F
+  4173,     // 105 deg F
+  4378,     // 110 deg F
+  4579,     // 115 deg F
+  4776,     // 120 deg F
+  4968,     // 125 deg F
+  5155,     // 130 deg F
+  5338,     // 135 deg F
+  5515,     // 140 deg F
+  5687,     // 145 deg F
+  5854,     // 150 deg F
+  6016,     // 155 deg F
+  6173,     // 160 deg F
+  6326,     // 165 deg F
+  6475,     // 170 deg F
+  6619,     // 175 deg F
+  6761,     // 180 deg F
+  6901,     // 185 deg F
+  7040,     // 190 deg F
+  7181,     // 195 deg F
+  7331,     // 200 deg F
+  7515,     // 205 deg F
+};
+
+#endif /* _THERMISTORTABLE_H */
@@ -0,0 +1,273 @@
+#!/usr/bin/env python3
+"""
+================================================================================
+File name:    ThermistorTable.py
+
+Platform:     Python 3, run by the pre build step of the Makefile
+
+Description:
+  Generates ThermistorTable.h, the table of ADC half units of the thermistor
+  divider at every THERMISTOR_TABLE_STEP deg F. The thermistor is connected
+  from the analog input to ground with the pull up resistor to the ADC
+  reference, so its resistance over the pull up resistance is
+
+    ratio = (8192 - halfUnits) / halfUnits
+
+  and the thermistor follows the Steinhart-Hart equation
+
+    1 / T = A + B * ln(ratio) + C * ln(ratio)^3
+
+  The part values are not recorded, so A, B and C are fitted by least squares
+  to the field calibrated two segment conversion of v2.5.14 between the open
+  and the short counts. No Beta curve, with or without a series or parallel
+  resistor, comes within 8 deg F of that conversion over the range, so the
+  third term is needed. The fitted curve turns over just outside the range and
+  the table is limited to 30..205 deg F. The counts above the mid point are
+  weighted, so the set points and the over heat are closest to the calibrated
+  conversion.
+
+  The generated table is checked against the calibrated conversion with the
+  integer interpolation of adcCountToTemperature(). The build fails if it is
+  more than FIT_TOLERANCE deg F away over the range, or FIT_SET_POINT_TOLERANCE
+  deg F from 150 deg F up. The counts used by the firmware, CHECK_POINTS, are
+  listed in the header with their table temperature.
+
+  Usage: python3 ThermistorTable.py [output file]
+================================================================================
+ History:
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+"""
+
+import math
+import os
+import sys
+
+# Half units of the full ADC count, (4096 * 2)
+ADC_FULL_HALF_UNITS = 8192
+
+# Table range and step in deg F. The open and the short counts are about 31
+# and 206 deg F, the conversions are clamped to the table range.
+FIRST_TEMPERATURE = 30
+LAST_TEMPERATURE = 205
+TEMPERATURE_STEP = 5
+
+# Two segment conversion of v2.5.14 in half units and deg F, as calibrated in
+# the field (below and above the mid point)
+CALIBRATION_MID_POINT = 5362
+CALIBRATION_BELOW_SLOPE = 0.023304
+CALIBRATION_BELOW_OFFSET = 8.8
+CALIBRATION_ABOVE_SLOPE = 0.033225
+CALIBRATION_ABOVE_OFFSET = 133.75
+
+# Range of the fit and of the check, THERMISTOR_OPEN_ADC_COUNT and
+# THERMISTOR_SHORT_ADC_COUNT of ADCRead.h
+FIT_FIRST_COUNT = 900
+FIT_LAST_COUNT = 7506
+FIT_COUNT_STEP = 2
+# Weight of the counts above the mid point, the set points and the over heat
+# are there
+FIT_ABOVE_MID_WEIGHT = 4
+# Calibrated 150 deg F, the set points and the over heat are above it
+FIT_SET_POINT_COUNT = 5851
+
+# Largest difference from the calibrated conversion in deg F, with the whole
+# degree rounding of adcCountToTemperature(), over the fitted range and from
+# FIT_SET_POINT_COUNT
+FIT_TOLERANCE = 3.0
+FIT_SET_POINT_TOLERANCE = 1.5
+
+# Counts used by the firmware and their calibrated meaning
+CHECK_POINTS = (
+    (900, "THERMISTOR_OPEN_ADC_COUNT"),
+    (3913, "DRY_FIRE_THRESHOLD_DEFAULT, 100 deg F"),
+    (5362, "calibration mid point"),
+    (7372, "over heat, 200 deg F"),
+    (7506, "THERMISTOR_SHORT_ADC_COUNT, 205 deg F"),
+)
+
+
+def calibrated_temperature(count):
+    if count <= CALIBRATION_MID_POINT:
+        return count * CALIBRATION_BELOW_SLOPE + CALIBRATION_BELOW_OFFSET
+    return (count - CALIBRATION_MID_POINT) * CALIBRATION_ABOVE_SLOPE + \
+        CALIBRATION_ABOVE_OFFSET
+
+
+def kelvin(temperature):
+    return (temperature - 32) / 1.8 + 273.15
+
+
+def fahrenheit(kelvins):
+    return (kelvins - 273.15) * 1.8 + 32
+
+
+def log_ratio(count):
+    return math.log((ADC_FULL_HALF_UNITS - count) / count)
+
+
+def fit_coefficients():
+    # Weighted normal equations of 1/T = A + B * y + C * y^3 over the
+    # calibrated range
+    rows = []
+    for count in range(FIT_FIRST_COUNT, FIT_LAST_COUNT + 1, FIT_COUNT_STEP):
+        y = log_ratio(count)
+        weight = FIT_ABOVE_MID_WEIGHT if count > CALIBRATION_MID_POINT else 1
+        rows.append(([1.0, y, y ** 3],
+                     1.0 / kelvin(calibrated_temperature(count)), weight))
+    matrix = [[sum(r[2] * r[0][i] * r[0][j] for r in rows)
+               for j in range(3)] +
+              [sum(r[2] * r[0][i] * r[1] for r in rows)] for i in range(3)]
+
+    # Gauss-Jordan elimination with partial pivoting
+    for i in range(3):
+        pivot = max(range(i, 3), key=lambda r: abs(matrix[r][i]))
+        matrix[i], matrix[pivot] = matrix[pivot], matrix[i]
+        for r in range(3):
+            if r != i:
+                factor = matrix[r][i] / matrix[i][i]
+                matrix[r] = [a - factor * b
+                             for a, b in zip(matrix[r], matrix[i])]
+    return [matrix[i][3] / matrix[i][i] for i in range(3)]
+
+
+def curve_temperature(coefficients, count):
+    y = log_ratio(count)
+    a, b, c = coefficients
+    return fahrenheit(1.0 / (a + b * y + c * y ** 3))
+
+
+def monotone_range(coefficients):
+    # Half units around the fitted range where the curve rises, the fitted
+    # curve is only used there
+    low = FIT_FIRST_COUNT
+    while low > 1 and curve_temperature(coefficients, low - 1) < \
+            curve_temperature(coefficients, low):
+        low -= 1
+    high = FIT_LAST_COUNT
+    while high < ADC_FULL_HALF_UNITS - 1 and \
+            curve_temperature(coefficients, high + 1) > \
+            curve_temperature(coefficients, high):
+        high += 1
+    return low, high
+
+
+def half_units(coefficients, count_range, temperature):
+    # Temperature of the curve rises with the half units, bisect for the count
+    low, high = count_range
+    for _ in range(60):
+        middle = (low + high) / 2
+        if curve_temperature(coefficients, middle) < temperature:
+            low = middle
+        else:
+            high = middle
+    return int(round((low + high) / 2))
+
+
+def table_temperature(table, count):
+    # Same integer interpolation as adcCountToTemperature()
+    if count <= table[0]:
+        return FIRST_TEMPERATURE
+    if count >= table[-1]:
+        return LAST_TEMPERATURE
+    index = max(i for i in range(len(table)) if table[i] <= count)
+    span = table[index + 1] - table[index]
+    return FIRST_TEMPERATURE + index * TEMPERATURE_STEP + \
+        ((count - table[index]) * TEMPERATURE_STEP + span // 2) // span
+
+
+def main():
+    if len(sys.argv) > 1:
+        path = sys.argv[1]
+    else:
+        path = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                            "ThermistorTable.h")
+
+    coefficients = fit_coefficients()
+    temperatures = range(FIRST_TEMPERATURE, LAST_TEMPERATURE + 1,
+                         TEMPERATURE_STEP)
+    count_range = monotone_range(coefficients)
+    if (curve_temperature(coefficients, count_range[0]) > FIRST_TEMPERATURE or
+            curve_temperature(coefficients, count_range[1]) <
+            LAST_TEMPERATURE):
+        sys.exit("ThermistorTable.py: table range is outside the fitted curve")
+    table = [half_units(coefficients, count_range, t) for t in temperatures]
+
+    # Both conversions need a strictly increasing table within the ADC range
+    for low, high in zip(table, table[1:]):
+        if high <= low:
+            sys.exit("ThermistorTable.py: table is not monotone")
+    if table[-1] >= ADC_FULL_HALF_UNITS:
+        sys.exit("ThermistorTable.py: table exceeds the ADC range")
+
+    # Table against the calibrated conversion
+    errors = []
+    for first, tolerance in ((FIT_FIRST_COUNT, FIT_TOLERANCE),
+                             (FIT_SET_POINT_COUNT, FIT_SET_POINT_TOLERANCE)):
+        worst = max(range(first, FIT_LAST_COUNT + 1),
+                    key=lambda n: abs(table_temperature(table, n) -
+                                      calibrated_temperature(n)))
+        error = table_temperature(table, worst) - calibrated_temperature(worst)
+        if abs(error) > tolerance:
+            sys.exit("ThermistorTable.py: %+.1f deg F from the calibration "
+                     "at %d" % (error, worst))
+        errors.append(error)
+
+    checks = []
+    for count, name in CHECK_POINTS:
+        checks.append("  %4d  %3d deg F, calibrated %5.1f deg F, %s" %
+                      (count, table_temperature(table, count),
+                       calibrated_temperature(count), name))
+
+    lines = []
+    lines.append("/*")
+    lines.append("=" * 80)
+    lines.append("File name:    ThermistorTable.h")
+    lines.append("")
+    lines.append("Description:")
+    lines.append("  Generated by ThermistorTable.py, do not edit. ADC half units "
+                 "of the")
+    lines.append("  thermistor at every %d deg F from %d deg F, Steinhart-Hart "
+                 "curve fitted to"
+                 % (TEMPERATURE_STEP, FIRST_TEMPERATURE))
+    lines.append("  the calibrated conversion of v2.5.14. It is within %+.1f deg F "
+                 "of it from %d"
+                 % (errors[0], FIT_FIRST_COUNT))
+    lines.append("  to %d half units and within %+.1f deg F from %d, 150 deg F."
+                 % (FIT_LAST_COUNT, errors[1], FIT_SET_POINT_COUNT))
+    lines.append("  Included only by TemperatureControl.c.")
+    lines.append("")
+    lines.append("    A = %.9e, B = %.9e, C = %.9e" % tuple(coefficients))
+    lines.append("")
+    lines.append("  Counts used by the firmware:")
+    lines.extend(checks)
+    lines.append("=" * 80)
+    lines.append("*/")
+    lines.append("")
+    lines.append("#ifndef _THERMISTORTABLE_H")
+    lines.append("#define _THERMISTORTABLE_H")
+    lines.append("")
+    lines.append("#define THERMISTOR_TABLE_FIRST_TEMPERATURE  %d" %
+                 FIRST_TEMPERATURE)
+    lines.append("#define THERMISTOR_TABLE_LAST_TEMPERATURE   %d" %
+                 LAST_TEMPERATURE)
+    lines.append("#define THERMISTOR_TABLE_STEP               %d" %
+                 TEMPERATURE_STEP)
+    lines.append("#define THERMISTOR_TABLE_SIZE               %d" % len(table))
+    lines.append("")
+    lines.append("static const uint16_t thermistorTableARYW"
+                 "[THERMISTOR_TABLE_SIZE] =")
+    lines.append("{")
+    for temperature, count in zip(temperatures, table):
+        lines.append("  %4d,     // %3d deg F" % (count, temperature))
+    lines.append("};")
+    lines.append("")
+    lines.append("#endif /* _THERMISTORTABLE_H */")
+
+    with open(path, "w", newline="\n") as output:
+        output.write("\n".join(lines) + "\n")
+
+
+if __name__ == "__main__":
+    main()
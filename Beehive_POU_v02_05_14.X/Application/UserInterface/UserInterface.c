@@ -70,6 +70,8 @@ IoTranslate requirements:
                    after 30 secs to save Power
 2.3.2  05-13-2021  When Display is in OFF state and error       Dnyaneshwar
                    occurs display turns ON to Flash error
+2.6.0  10-16-2026  Error code is added for the task
+                   watchdog error.
 --------------------------------------------------------------------------------
 */
 
@@ -126,7 +128,8 @@ static const uint16_t errorCodesDisplayARY[] =
   ERROR_CODE_IO_TEST,
   ERROR_CODE_EEPROM_CRC_TEST,
   ERROR_CODE_BUTTON_MALFUNCTION,
-  ERROR_CODE_TEMPERATURE_MODE
+  ERROR_CODE_TEMPERATURE_MODE,
+  ERROR_CODE_TASK_WATCHDOG
 };
 
 /*
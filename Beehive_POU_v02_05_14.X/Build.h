@@ -22,6 +22,30 @@ Resources:
        09-23-2019  Initial Write                            Poorana kumar G
 2.2.0  07-16-2020  New macro is added to disable the inlet  Poorana kumar G
                    thermistor in build time.
+2.6.0  10-16-2026  New macro is added to measure the
+                   execution time of the scheduled tasks.
+2.6.0  10-16-2026  New macro is added to put the CPU in
+                   Idle between the scheduler ticks.
+2.6.0  10-16-2026  New macro is added to build the task
+                   table at compile time.
+2.6.0  10-16-2026  New macro is added to run the 1 ms
+                   critical tasks in the Timer ISR.
+2.6.0  10-16-2026  New macro is added to shed the non
+                   critical tasks under overload.
+2.6.0  10-16-2026  New macro is added to run the tasks on
+                   the scheduler events.
+2.6.0  10-16-2026  New macro is added to refresh the
+                   watchdog only when all the tasks check in.
+2.6.0  10-16-2026  New macro is added to convert all the
+                   ADC channels by the DMA driven scan.
+2.6.0  10-16-2026  New macro is added to check the chamber
+                   thermistor readings for plausibility.
+2.6.0  10-16-2026  New macro is added for the ADC offset &
+                   gain self calibration.
+2.6.0  10-16-2026  New macro is added to oversample the
+                   thermistor channels in the DMA scan.
+2.6.0  10-16-2026  New macro is added for the lag
+                   compensation of the thermistors.
 --------------------------------------------------------------------------------
 */
 
@@ -47,6 +71,57 @@ Resources:
 // Uncomment this macro to block the inlet thermistor related process
 #define DISABLE_INLET_THERMISTOR
 
+// Uncomment this macro to measure the execution time of the scheduled tasks
+//#define SCHEDULER_PROFILE
+
+// Uncomment this macro to put the CPU in Idle mode between the scheduler ticks
+//#define SCHEDULER_TICKLESS_IDLE
+
+// Uncomment this macro to run the opto coupler control and the flow pulse
+// counting in the Timer ISR instead of the scheduler
+#define SCHEDULER_ISR_LANE
+
+// Uncomment this macro to use the compile time task table in Scheduler.h
+// instead of registering the tasks through scheduler.AddTask()
+#define SCHEDULER_STATIC_TASKS
+
+// Uncomment this macro to stretch the non critical tasks under overload before
+// OVER_RUN_ERROR is reported
+#define SCHEDULER_LOAD_SHEDDING
+
+// Uncomment this macro to run the temperature control when the ADC scan is
+// completed instead of its own 500 ms timer
+#define SCHEDULER_EVENT_TRIGGER
+
+// Uncomment this macro to refresh the watchdog only when every scheduled task
+// has completed within its watchdog window
+#define SCHEDULER_TASK_WATCHDOG
+
+// Uncomment this macro to convert all the ADC channels back to back by the DMA
+// driven scan instead of one channel per ADCRead() state machine pass
+#define ADCREAD_DMA_SCAN
+
+// Uncomment this macro to hold the implausible chamber thermistor readings till
+// they are confirmed by the next samples
+#define ADCREAD_PLAUSIBILITY
+
+// Uncomment this macro to correct the offset & gain of the ADC from the
+// discharged CTMU conversion and the VCC/2 reference, stored with the settings
+#define ADCREAD_SELF_CALIBRATION
+
+// Uncomment this macro to convert each thermistor channel 16 times in the DMA
+// scan and decimate the conversions to 14 bits
+#define ADCREAD_OVERSAMPLING
+
+// Uncomment this macro to compensate the thermal lag of the thermistors by a
+// lead computed from their slope
+#define ADCREAD_LAG_COMPENSATION
+
+#ifndef ADCREAD_DMA_SCAN
+// Oversampling needs the conversions of the DMA driven scan
+#undef ADCREAD_OVERSAMPLING
+#endif
+
 #define SCHEDULER_MAX_TASKS         10  // Maximum tasks can be scheduled.
 
 #define TOTAL_ADC_CHANNELS          8       // Total analog inputs
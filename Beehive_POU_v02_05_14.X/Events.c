@@ -56,6 +56,9 @@ Resources:
  History:	
 -*-----*-----------*------------------------------------*-----------------------
        09-30-2019  Initial Write                        Poorana kumar G
+2.6.0  10-16-2026  Scheduler tick count is incremented.
+2.6.0  10-16-2026  ISR lane tasks are executed after the
+                   AC line cross check.
 --------------------------------------------------------------------------------
 */
 
@@ -66,6 +69,7 @@ void TimerISRFunction(void)
 
   // Set the interrupt flag to execute the scheduler
   scheduler.flags.interruptFLG = 1;
+  scheduler.tickCountW++;
 
   // If GPIO status change detected
   if ( LineCrossFlg) {
@@ -83,6 +87,11 @@ void TimerISRFunction(void)
       optoCouplerControl.lcCount++;
     }
   }
+
+#ifdef SCHEDULER_ISR_LANE
+  // Execute the 1 ms critical tasks, not delayed by the background tasks
+  scheduler.RunISRLane();
+#endif
   
   // One second timer
   if ( ++optoCouplerControl.lcCheckTimer >= ONE_SEC_IN_MS ) {
@@ -22,6 +22,8 @@ Resources:
  History:	
 -*-----*-----------*------------------------------------*-----------------------
        05-12-2020  Initial Write                        Poorana kumar G
+2.6.0  10-16-2026  Analog pin probe is split into start and
+                   end, to be read on a later scan.
 --------------------------------------------------------------------------------
 */
 
@@ -30,12 +32,13 @@ Resources:
 
 /*
 ================================================================================
-Method name:  readADCIOStatus
+Method name:  ADCReadProbeStart
                     
 Originator:   Poorana kumar G
 
 Description: 
-  To read the digital status of the analog input pin.
+  To configure the analog input pin as GPIO with the internal pull up, so its
+  digital status can be read by ADCReadProbeEnd() once the IO level is settled.
 
 Resources:
   None
@@ -44,14 +47,14 @@ Resources:
  History:	
 -*-----*-----------*------------------------------------*-----------------------
        05-12-2020  Initial Write                        Poorana kumar G
+2.6.0  10-16-2026  Split from readADCIOStatus(), the IO
+                   level settles till a later scan instead
+                   of the delay loop.
 --------------------------------------------------------------------------------
 */
 
-bool readADCIOStatus(uint8_t adcNum)
+void ADCReadProbeStart(uint8_t adcNum)
 {
-  bool status = 0;
-  uint16_t delayW = 0;
-
   // Configure the relevant analog input as GPIO with internal pull up
   switch(adcNum) {
     case INLET_TEMPERATURE:
@@ -87,9 +90,32 @@ bool readADCIOStatus(uint8_t adcNum)
     default:
       break;
   }
+}
+
+/*
+================================================================================
+Method name:  ADCReadProbeEnd
+                    
+Originator:   Poorana kumar G
+
+Description: 
+  To read the digital status of the analog input pin configured by
+  ADCReadProbeStart() and to configure it back as analog input.
+
+Resources:
+  None
 
-  // Wait to IO level is settling
-  for (delayW = 0; delayW < 3000; delayW++);
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+       05-12-2020  Initial Write                        Poorana kumar G
+2.6.0  10-16-2026  Split from readADCIOStatus().
+--------------------------------------------------------------------------------
+*/
+
+bool ADCReadProbeEnd(uint8_t adcNum)
+{
+  bool status = 0;
 
   // Read IO digital status & configure it as analog input
   switch(adcNum) {
@@ -22,6 +22,10 @@ Resources:
  History:	
 -*-----*-----------*------------------------------------*-----------------------
        09-23-2019  Initial Write                        Poorana kumar G
+2.6.0  10-16-2026  Scheduler timer counter macros added.
+2.6.0  10-16-2026  CPU Idle and interrupt mask macros added.
+2.6.0  10-16-2026  ADC DMA scan macros and start function
+                   added.
 --------------------------------------------------------------------------------
 */
 
@@ -44,6 +48,30 @@ Resources:
 // MACROS USED IN SCHEDULER
 #define START_SCHEDULER_TIMER()             TMR1_Start()
 
+// Read the scheduler timer counter, runs from 0 to PR1 in every 1 ms tick
+#define SCHEDULER_TIMER_COUNT()             TMR1_Counter16BitGet()
+
+// Scheduler timer counts in every 1 ms tick
+#define SCHEDULER_TIMER_TICK_COUNTS         (TMR1_Period16BitGet() + 1u)
+
+// Enter the CPU Idle mode, any enabled interrupt wakes up the CPU
+#define SCHEDULER_CPU_IDLE()                Idle()
+
+// Mask all the interrupts, the masked interrupts still wake up from Idle
+#define SCHEDULER_MASK_INTERRUPTS(savedIPL) SET_AND_SAVE_CPU_IPL(savedIPL, 7)
+
+// Restore the interrupt level, pending interrupts are serviced here
+#define SCHEDULER_UNMASK_INTERRUPTS(savedIPL) RESTORE_CPU_IPL(savedIPL)
+
+// CPU is reset by the watchdog time out
+#define SCHEDULER_WATCHDOG_RESET()          (RCONbits.WDTO)
+
+// Clear the watchdog time out reset flag
+#define SCHEDULER_WATCHDOG_RESET_CLEAR()    (RCONbits.WDTO = 0)
+
+// Variable kept over the resets, not cleared by the start up code
+#define SCHEDULER_PERSISTENT                __attribute__((persistent))
+
 
 // MACROS USED IN ADCREAD
 // Selects ADC channel to do conversion
@@ -61,6 +89,18 @@ Resources:
 // Read the converted value
 #define ADCREAD_READ_REGISTER()             ADC1_Channel0ConversionResultGet()
 
+// DMA has filled one of the scan buffers
+#define ADCREAD_DMA_SCAN_COMPLETE()         (IFS0bits.DMA0IF)
+
+// Clear the scan buffer filled status
+#define ADCREAD_DMA_SCAN_CLEAR()            (IFS0bits.DMA0IF = 0)
+
+// DMA is filling the scan buffer B, so buffer A has the latest scan
+#define ADCREAD_DMA_BUFFER_B_ACTIVE()       (DMAPPSbits.PPST0)
+
+// DMA request number of the ADC1 conversion done
+#define ADCREAD_DMA_REQUEST_ADC1            0x0D
+
 
 // MACROS USED IN FAULTINDICATION
 // To turn ON the Celsius LED
@@ -365,8 +405,94 @@ inline static void ADCReadStopDischarge(void)
 }
 
 
+/*
+================================================================================
+Method name:  ADCReadDMAScanStart
+                    
+Originator:   
+
+Description: 
+  This function is used to start the DMA driven ADC scan. Timer 3 ends the
+  sampling and starts one conversion in every period. The ADC clock is set from
+  adcsW, so the conversion takes a small part of the period and the sampling
+  the rest of it. The MCC setting of the ADC clock is too slow for the
+  oversampling, its 14 TAD conversion takes 1400 Tcy. On each conversion done,
+  DMA0 moves the result into the ping-pong scan buffers and DMA1 writes the
+  input of the next conversion from the input table. The CTMU node is kept
+  discharged, so converting it discharges the sample & hold capacitor.
+
+  The input table holds the input of conversion (n + 1) at index n, and its
+  last entry is the input of the first conversion.
+
+  This method should be called using ADCReadDMAScanStart().
+
+Resources:
+  ADC1, Timer 3, DMA0, DMA1 and CTMU
+
+================================================================================
+ History:	
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+2.6.0  10-16-2026  ADC clock is set for the scan.
+--------------------------------------------------------------------------------
+*/
+
+inline static void ADCReadDMAScanStart(volatile uint16_t *scanAPTRW,      \
+        volatile uint16_t *scanBPTRW, uint16_t *inputTablePTRW,           \
+        uint16_t conversionsW, uint16_t periodCountsW, uint16_t adcsW)
+{
+  // Stop the ADC to change the conversion trigger
+  AD1CON1bits.ADON = 0;
+
+  // Keep the CTMU node discharged
+  CTMUCON1bits.IDISSEN = 1;
+
+  // Timer 3 at Fcy, 1:1 prescaler
+  T3CON = 0x0000;
+  TMR3 = 0;
+  PR3 = periodCountsW - 1;
+
+  // DMA0: Word, ADC1 to RAM, post increment, continuous ping-pong
+  DMA0CON = 0x0002;
+  DMA0REQ = ADCREAD_DMA_REQUEST_ADC1;
+  DMA0PAD = (uint16_t) &ADC1BUF0;
+  DMA0STAL = (uint16_t) scanAPTRW;
+  DMA0STAH = 0;
+  DMA0STBL = (uint16_t) scanBPTRW;
+  DMA0STBH = 0;
+  DMA0CNT = conversionsW - 1;
+  IFS0bits.DMA0IF = 0;
+  DMA0CONbits.CHEN = 1;
+
+  // DMA1: Word, RAM to ADC1 input select, post increment, continuous
+  DMA1CON = 0x2000;
+  DMA1REQ = ADCREAD_DMA_REQUEST_ADC1;
+  DMA1PAD = (uint16_t) &AD1CHS0;
+  DMA1STAL = (uint16_t) inputTablePTRW;
+  DMA1STAH = 0;
+  DMA1CNT = conversionsW - 1;
+  DMA1CONbits.CHEN = 1;
+
+  // Input of the first conversion, result in ADC1BUF0 after every conversion
+  AD1CHS0 = inputTablePTRW[conversionsW - 1];
+  AD1CON2 = 0x0000;
+  AD1CON4 = 0x0000;
+
+  // ADC clock from Tcy, TAD = (adcsW + 1) Tcy. SAMC is not used, as Timer 3
+  // ends the sampling.
+  AD1CON3 = adcsW & 0x00FF;
+
+  // 12-bit, auto sampling, Timer 3 compare ends sampling & starts conversion
+  AD1CON1 = 0x0444;
+  AD1CON1bits.ADON = 1;
+
+  T3CONbits.TON = 1;
+}
+
+
 // FUNCTIONS
-bool readADCIOStatus(uint8_t adcNum);
+void ADCReadProbeStart(uint8_t adcNum);
+bool ADCReadProbeEnd(uint8_t adcNum);
 
 #endif	/* _IO_TRANSLATE_H */
 
@@ -0,0 +1,612 @@
+/*
+================================================================================
+File name:    PIDEquivalenceTest.c
+
+Originator:
+
+Platform:     Host, gcc
+
+Description:
+  Host test of the fixed point PID step of PIDControl.h against the float
+  PIDCalculation() it replaced. Both are given the same target, outlet
+  temperature and rate over the trajectories below, and the power cycles and
+  the integrals are compared. At every power cycle that differs, the exact
+  power of the float constants is worked out in long double, and it must be
+  within the rounding of the two versions of a whole power cycle count.
+
+    - Heat up and hold of a simple water heater model driven by the fixed
+      point power, with sensor noise, flow steps and set point steps.
+    - Random walks of the outlet temperature and its rate over the whole ADC
+      half unit range.
+
+  Each trajectory is run with the initial PID constants, the previous
+  constants and random constants. The test fails if an integral differs, if a
+  power cycle differs by more than PID_TEST_MAX_DIFFERENCE, if a difference is
+  not at a whole count or if more than PID_TEST_MAX_MISMATCH_PPM of the power
+  cycles differ.
+
+  Usage: make -C Test/PIDEquivalence test
+
+Resources:
+  None
+================================================================================
+ History:
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "PIDControl.h"
+
+// Limits of the comparison
+#define PID_TEST_MAX_DIFFERENCE     1           // Power cycle counts
+#define PID_TEST_MAX_MISMATCH_PPM   1000        // 0.1%
+// Relative rounding of the float calculation, a few float operations
+#define PID_TEST_FLOAT_ROUNDING     (8.0L / 16777216.0L)
+
+// Trajectories
+#define PID_TEST_PLANT_RUNS         400
+#define PID_TEST_PLANT_STEPS        7200        // One hour of 500 ms steps
+#define PID_TEST_WALK_RUNS          400
+#define PID_TEST_WALK_STEPS         7200
+#define PID_TEST_RANDOM_GAINS       8
+
+// ADC half units of the full ADC count, (4096 * 2)
+#define ADC_FULL_HALF_UNITS         8192
+
+#define MAXPOWER_POWER_CYCLE        PID_MAX_POWER_CYCLE
+
+// PID constants as in the settings
+#define PID_CONST_KP                pidConstantsARYF[0]
+#define PID_CONST_KI                pidConstantsARYF[1]
+#define PID_CONST_KDI               pidConstantsARYF[2]
+#define PID_CONST_KDD               pidConstantsARYF[3]
+#define PID_CONST_HI_ERR_THRESH     pidConstantsARYF[4]
+#define PID_CONST_PREBURN_LIMIT     pidConstantsARYF[5]
+#define PID_CONSTANTS               6
+
+// Inputs and state of the float PIDCalculation()
+typedef struct {
+  int16_t targetADCHalfUnitsW;
+  int16_t outletTemperatureW;
+  int16_t dtOutletTemperatureW;
+  float integralF;
+} FloatControl_STYP;
+
+// Counts of the comparison
+typedef struct {
+  uint32_t samplesL;
+  uint32_t mismatchesL;
+  uint32_t integralMismatchesL;
+  uint32_t boundaryMismatchesL;         // Not at a whole count
+  int16_t maxDifferenceW;
+} PIDTestResult_STYP;
+
+static float pidConstantsARYF[PID_CONSTANTS];
+static FloatControl_STYP tempControl;
+static uint32_t randomStateL = 0x2545F491UL;
+
+// Initial constants of NonVol.h, and the previous ones
+static const float initialConstantsARYF[PID_CONSTANTS] =
+{
+  0.0015f, 0.0024f, 0.75f, 0.05f, 32.0620f, 0.0625f
+};
+static const float previousConstantsARYF[PID_CONSTANTS] =
+{
+  0.075f, 0.005f, 5.0f, 1.0f, (1.0f / DegPerADHalfUnit), (0.5f / 8.0f)
+};
+
+/*
+================================================================================
+Method name:  FloatPIDCalculation
+
+Originator:   Poorana kumar G
+
+Description:
+  The float PIDCalculation() of v2.5.14, the power cycle is returned in place
+  of being set to the opto coupler.
+
+Resources:
+ None
+
+================================================================================
+ History:
+-*-----*-----------*------------------------------------*-----------------------
+       10-09-2019  Initial Write                        Poorana kumar G
+2.6.0  10-16-2026  Copied for the host test.
+--------------------------------------------------------------------------------
+ */
+
+static uint8_t
+FloatPIDCalculation (void)
+{
+  float fpower = 0.0f;
+  int16_t errorW = 0;
+
+  errorW = (tempControl.targetADCHalfUnitsW - tempControl.outletTemperatureW) / 2;
+  tempControl.integralF = tempControl.integralF + errorW;
+
+  // Limit the integral
+  if (tempControl.integralF > eeIntegralLimit)
+    {
+      tempControl.integralF = eeIntegralLimit;
+    }
+  if (tempControl.integralF < 0.0f)
+    {
+      tempControl.integralF = 0.0f;
+    }
+
+  // 'P' Term and 'I' Term
+  fpower = (PID_CONST_KP * errorW) + (PID_CONST_KI * tempControl.integralF);
+
+  // If target temperature is near reduce the power cycle based on rate of
+  // change of outlet temperature
+  if (errorW < ErrorLimitForKDToKickIn)
+    {
+      if (tempControl.dtOutletTemperatureW > 0)
+        {
+          fpower = fpower - (PID_CONST_KDI * tempControl.dtOutletTemperatureW / 2);
+        }
+      else
+        {
+          fpower = fpower - (PID_CONST_KDD * tempControl.dtOutletTemperatureW / 2);
+        }
+    }
+
+  // This is the preburn, dump in a bunch of power
+  // If so cold its below hi_err_thresh AND not increasing "enough"
+  if ((errorW * 2 > PID_CONST_HI_ERR_THRESH) &&                            \
+          (tempControl.dtOutletTemperatureW < PID_CONST_PREBURN_LIMIT))
+    {
+      fpower = fpower + (PID_CONST_PREBURN_LIMIT * errorW);
+    }
+
+  //If so cold its below hi_err_thresh, back off proportional to the rate,
+  // basically more damping,
+  if ((errorW * 2) > PID_CONST_HI_ERR_THRESH)
+    {
+      fpower = fpower -                                                       \
+            (PID_CONST_PREBURN_LIMIT * tempControl.dtOutletTemperatureW / 2);
+    }
+
+  // Limit the power
+  if (fpower > MAXPOWER_POWER_CYCLE)
+    {
+      fpower = MAXPOWER_POWER_CYCLE;
+    }
+
+  // Limit the power
+  if (fpower < 0.0f)
+    {
+      fpower = 0;
+    }
+
+  return (unsigned char) fpower;
+}
+
+/*
+================================================================================
+Method name:  TestRandom
+
+Originator:
+
+Description:
+  The purpose of this function is to return the next number of the xorshift
+  generator, so every run gives the same trajectories.
+
+Resources:
+ None
+
+================================================================================
+ History:
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+ */
+
+static uint32_t
+TestRandom (void)
+{
+  randomStateL ^= randomStateL << 13;
+  randomStateL ^= randomStateL >> 17;
+  randomStateL ^= randomStateL << 5;
+  return randomStateL;
+}
+
+/*
+================================================================================
+Method name:  TestRange
+
+Originator:
+
+Description:
+  The purpose of this function is to return a random whole number from the
+  lowest to the highest.
+
+Resources:
+ None
+
+================================================================================
+ History:
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+ */
+
+static int32_t
+TestRange (int32_t lowest, int32_t highest)
+{
+  return lowest + (int32_t) (TestRandom () % (uint32_t) (highest - lowest + 1));
+}
+
+/*
+================================================================================
+Method name:  TestAtWholeCount
+
+Originator:
+
+Description:
+  The purpose of this function is to return 1 if the exact power of the float
+  constants is within the rounding of the two calculations of a whole count,
+  so the power cycles can be truncated to the counts either side of it. The
+  gains are rounded to half of 1 >> PID_GAIN_SHIFT, and the float sum has the
+  relative rounding of PID_TEST_FLOAT_ROUNDING.
+
+Resources:
+ None
+
+================================================================================
+ History:
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+ */
+
+static int
+TestAtWholeCount (int16_t targetW, int16_t outletW, int16_t rateW,
+        int32_t integralL)
+{
+  long double termARY[PID_TERMS] = {0.0L, 0.0L, 0.0L, 0.0L, 0.0L};
+  long double constantARY[PID_TERMS] = {0.0L, 0.0L, 0.0L, 0.0L, 0.0L};
+  long double power = 0.0L;
+  long double rounding = 0.0L;
+  long double distance;
+  int16_t errorW;
+  uint8_t index;
+
+  errorW = (targetW - outletW) / 2;
+
+  termARY[PID_TERM_P] = errorW;
+  constantARY[PID_TERM_P] = PID_CONST_KP;
+  termARY[PID_TERM_I] = integralL;
+  constantARY[PID_TERM_I] = PID_CONST_KI;
+  if (errorW < ErrorLimitForKDToKickIn)
+    {
+      termARY[PID_TERM_D] = -rateW / 2.0L;
+      constantARY[PID_TERM_D] = (rateW > 0) ? PID_CONST_KDI : PID_CONST_KDD;
+    }
+  if ((errorW * 2 > PID_CONST_HI_ERR_THRESH) &&
+          (rateW < PID_CONST_PREBURN_LIMIT))
+    {
+      termARY[PID_TERM_PREBURN] = errorW;
+      constantARY[PID_TERM_PREBURN] = PID_CONST_PREBURN_LIMIT;
+    }
+  if ((errorW * 2) > PID_CONST_HI_ERR_THRESH)
+    {
+      termARY[PID_TERM_DAMPING] = -rateW / 2.0L;
+      constantARY[PID_TERM_DAMPING] = PID_CONST_PREBURN_LIMIT;
+    }
+
+  for (index = 0; index < PID_TERMS; index++)
+    {
+      power += constantARY[index] * termARY[index];
+      rounding += fabsl (termARY[index]) / (2.0L * PID_GAIN_ONE) +
+              fabsl (constantARY[index] * termARY[index]) *
+              PID_TEST_FLOAT_ROUNDING;
+    }
+
+  if (power > MAXPOWER_POWER_CYCLE)
+    {
+      power = MAXPOWER_POWER_CYCLE;
+    }
+  if (power < 0.0L)
+    {
+      power = 0.0L;
+    }
+
+  distance = fabsl (power - roundl (power));
+  return (distance <= rounding) ? 1 : 0;
+}
+
+/*
+================================================================================
+Method name:  TestStep
+
+Originator:
+
+Description:
+  The purpose of this function is to run one step of both PID calculations
+  with the same inputs and count the differences. The fixed point power cycle
+  is returned, as it drives the heater.
+
+Resources:
+ None
+
+================================================================================
+ History:
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+ */
+
+static uint8_t
+TestStep (const PIDGains_STYP *gainsPTR, int32_t *integralPTRL,
+        int16_t targetW, int16_t outletW, int16_t rateW,
+        PIDTestResult_STYP *resultPTR)
+{
+  uint8_t fixedPower;
+  uint8_t floatPower;
+  int16_t differenceW;
+
+  tempControl.targetADCHalfUnitsW = targetW;
+  tempControl.outletTemperatureW = outletW;
+  tempControl.dtOutletTemperatureW = rateW;
+
+  floatPower = FloatPIDCalculation ();
+  fixedPower = PIDStep (gainsPTR, integralPTRL, targetW, outletW, rateW);
+
+  resultPTR->samplesL++;
+  if ((float) *integralPTRL != tempControl.integralF)
+    {
+      resultPTR->integralMismatchesL++;
+    }
+
+  differenceW = (int16_t) fixedPower - (int16_t) floatPower;
+  if (differenceW < 0)
+    {
+      differenceW = -differenceW;
+    }
+  if (differenceW != 0)
+    {
+      resultPTR->mismatchesL++;
+      if (TestAtWholeCount (targetW, outletW, rateW, *integralPTRL) == 0)
+        {
+          resultPTR->boundaryMismatchesL++;
+        }
+      if (differenceW > resultPTR->maxDifferenceW)
+        {
+          resultPTR->maxDifferenceW = differenceW;
+        }
+    }
+
+  return fixedPower;
+}
+
+/*
+================================================================================
+Method name:  TestPlant
+
+Originator:
+
+Description:
+  The purpose of this function is to run the PID calculations on a heater
+  model. The outlet temperature rises with the fixed point power and falls
+  towards the inlet temperature with the flow. The flow, the inlet and the set
+  point step at random times, and the ADC reading has noise. The rate is the
+  difference of the readings over one step, as the outlet derivative.
+
+Resources:
+ None
+
+================================================================================
+ History:
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+ */
+
+static void
+TestPlant (const PIDGains_STYP *gainsPTR, PIDTestResult_STYP *resultPTR)
+{
+  int32_t integralL = 0;
+  float outlet;
+  float inlet;
+  float flow;
+  int16_t targetW;
+  int16_t readingW;
+  int16_t previousW;
+  uint8_t power = 0;
+  uint16_t step;
+
+  inlet = (float) TestRange (2500, 4500);
+  outlet = inlet;
+  flow = (float) TestRange (5, 60) / 1000.0f;
+  targetW = (int16_t) TestRange (4500, 7400);
+  tempControl.integralF = 0.0f;
+  previousW = (int16_t) outlet;
+
+  for (step = 0; step < PID_TEST_PLANT_STEPS; step++)
+    {
+      if (TestRange (0, 599) == 0)
+        {
+          flow = (float) TestRange (5, 60) / 1000.0f;
+        }
+      if (TestRange (0, 1199) == 0)
+        {
+          inlet = (float) TestRange (2500, 4500);
+        }
+      if (TestRange (0, 1799) == 0)
+        {
+          targetW = (int16_t) TestRange (4500, 7400);
+        }
+
+      outlet = outlet + ((float) power * 0.35f) - ((outlet - inlet) * flow);
+      if (outlet > (ADC_FULL_HALF_UNITS - 1))
+        {
+          outlet = ADC_FULL_HALF_UNITS - 1;
+        }
+
+      readingW = (int16_t) outlet + (int16_t) TestRange (-6, 6);
+      power = TestStep (gainsPTR, &integralL, targetW, readingW,
+              readingW - previousW, resultPTR);
+      previousW = readingW;
+    }
+}
+
+/*
+================================================================================
+Method name:  TestWalk
+
+Originator:
+
+Description:
+  The purpose of this function is to run the PID calculations on random walks
+  of the outlet temperature and of the rate, so every branch and both power
+  limits are reached.
+
+Resources:
+ None
+
+================================================================================
+ History:
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+ */
+
+static void
+TestWalk (const PIDGains_STYP *gainsPTR, PIDTestResult_STYP *resultPTR)
+{
+  int32_t integralL = 0;
+  int32_t outletL;
+  int32_t rateL = 0;
+  int16_t targetW;
+  uint16_t step;
+
+  targetW = (int16_t) TestRange (900, ADC_FULL_HALF_UNITS - 1);
+  outletL = TestRange (900, ADC_FULL_HALF_UNITS - 1);
+  tempControl.integralF = 0.0f;
+
+  for (step = 0; step < PID_TEST_WALK_STEPS; step++)
+    {
+      rateL = rateL + TestRange (-8, 8);
+      if (rateL > 400)
+        {
+          rateL = 400;
+        }
+      if (rateL < -400)
+        {
+          rateL = -400;
+        }
+      outletL = outletL + (rateL / 8);
+      if ((outletL < 0) || (outletL > (ADC_FULL_HALF_UNITS - 1)))
+        {
+          outletL = TestRange (0, ADC_FULL_HALF_UNITS - 1);
+          rateL = -rateL;
+        }
+      if (TestRange (0, 999) == 0)
+        {
+          targetW = (int16_t) TestRange (900, ADC_FULL_HALF_UNITS - 1);
+        }
+
+      (void) TestStep (gainsPTR, &integralL, targetW, (int16_t) outletL,
+              (int16_t) rateL, resultPTR);
+    }
+}
+
+/*
+================================================================================
+Method name:  TestConstants
+
+Originator:
+
+Description:
+  The purpose of this function is to run all the trajectories with the PID
+  constants, print the counts and return 1 if they are out of the limits.
+
+Resources:
+ None
+
+================================================================================
+ History:
+-*-----*-----------*------------------------------------*-----------------------
+2.6.0  10-16-2026  Initial Write
+--------------------------------------------------------------------------------
+ */
+
+static int
+TestConstants (const char *name, const float *constantsPTRF)
+{
+  PIDGains_STYP gains = PID_GAINS_DEFAULTS;
+  PIDTestResult_STYP result = {0, 0, 0, 0, 0};
+  uint16_t run;
+  uint8_t index;
+  int failed = 0;
+
+  for (index = 0; index < PID_CONSTANTS; index++)
+    {
+      pidConstantsARYF[index] = constantsPTRF[index];
+    }
+  PIDGainsLoad (&gains, PID_CONST_KP, PID_CONST_KI, PID_CONST_KDI,
+          PID_CONST_KDD, PID_CONST_HI_ERR_THRESH, PID_CONST_PREBURN_LIMIT);
+
+  for (run = 0; run < PID_TEST_PLANT_RUNS; run++)
+    {
+      TestPlant (&gains, &result);
+    }
+  for (run = 0; run < PID_TEST_WALK_RUNS; run++)
+    {
+      TestWalk (&gains, &result);
+    }
+
+  if ((result.integralMismatchesL != 0) ||
+          (result.boundaryMismatchesL != 0) ||
+          (result.maxDifferenceW > PID_TEST_MAX_DIFFERENCE) ||
+          ((uint64_t) result.mismatchesL * 1000000u >
+           (uint64_t) result.samplesL * PID_TEST_MAX_MISMATCH_PPM))
+    {
+      failed = 1;
+    }
+
+  printf ("%-10s %8lu samples, %5lu differ (%.4f%%), max %d, "
+          "not at a count %lu, integral differs %lu  %s\n", name,
+          (unsigned long) result.samplesL, (unsigned long) result.mismatchesL,
+          100.0 * result.mismatchesL / result.samplesL,
+          result.maxDifferenceW, (unsigned long) result.boundaryMismatchesL,
+          (unsigned long) result.integralMismatchesL,
+          failed ? "FAIL" : "ok");
+
+  return failed;
+}
+
+int
+main (void)
+{
+  float constantsARYF[PID_CONSTANTS];
+  char name[16];
+  uint8_t set;
+  int failed = 0;
+
+  failed |= TestConstants ("initial", initialConstantsARYF);
+  failed |= TestConstants ("previous", previousConstantsARYF);
+
+  for (set = 0; set < PID_TEST_RANDOM_GAINS; set++)
+    {
+      constantsARYF[0] = (float) TestRange (1, 100000) / 1000000.0f;
+      constantsARYF[1] = (float) TestRange (1, 10000) / 1000000.0f;
+      constantsARYF[2] = (float) TestRange (1, 10000) / 1000.0f;
+      constantsARYF[3] = (float) TestRange (1, 2000) / 1000.0f;
+      constantsARYF[4] = (float) TestRange (0, 100000) / 1000.0f;
+      constantsARYF[5] = (float) TestRange (1, 1000) / 1000.0f;
+      snprintf (name, sizeof (name), "random %u", set);
+      failed |= TestConstants (name, constantsARYF);
+    }
+
+  printf ("%s\n", failed ? "PID equivalence FAILED" : "PID equivalence ok");
+  return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
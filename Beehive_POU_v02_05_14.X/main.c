@@ -59,6 +59,7 @@
 #include "Events.h"
 #include "SelfTest.h"
 #include "TemperatureControl.h"
+#include "DSPKernel.h"
 #include "Version.h"
 
 #ifdef DEBUG_MACRO
@@ -93,6 +94,11 @@ int main(void)
   // initialize the device
   SYSTEM_Initialize();
 
+#ifdef SCHEDULER_TASK_WATCHDOG
+  // Report the task which stopped the watchdog refresh before the reset
+  scheduler.CheckWatchdogReset();
+#endif
+
   // Start watchdog timer
   START_WATCHDOG();
 
@@ -101,9 +107,18 @@ int main(void)
 
   CTMUCON1bits.CTMUEN = 1;
 
+  // Fractional mode, rounding & saturation of the DSP engine for the kernels
+  DSP_KERNEL_INIT();
+
   // Initialize the non volatile memory
   nonVol.init();
 
+  // Convert the PID constants of the settings to the fixed point gains
+  tempControl.LoadGains();
+
+  // Correct the first ADC scans by the stored self calibration
+  adcRead.LoadCalibration();
+
   // Execute the power ON self test
   selfTest.POST();
 
@@ -115,26 +130,41 @@ int main(void)
   // Trigger the ADC conversion
 //  adcRead.TriggerConversion();
 
+#ifdef SCHEDULER_STATIC_TASKS
+  // Queue the tasks of the compile time task table
+  scheduler.Init();
+#else
+#ifndef SCHEDULER_ISR_LANE
   scheduler.AddTask(optoCouplerControl.Modulate,                            \
-          OPTOCOUPLER_CONTROL_INITIAL_DELAY, OPTOCOUPLER_CONTROL_INTERVAL);
+          OPTOCOUPLER_CONTROL_INITIAL_DELAY, OPTOCOUPLER_CONTROL_INTERVAL,  \
+          SCHEDULER_SHED_NONE);
+#endif
   scheduler.AddTask(uI.UIFunction, USER_INTERFACE_INITIAL_DELAY,            \
-          USER_INTERFACE_INTERVAL);
+          USER_INTERFACE_INTERVAL, SCHEDULER_SHED_BACKGROUND);
   scheduler.AddTask(flowDetector.Detect, FLOW_DETECTOR_INITIAL_DELAY,       \
-          FLOW_DETECTOR_INTERVAL);
+          FLOW_DETECTOR_INTERVAL, SCHEDULER_SHED_NONE);
   scheduler.AddTask(adcRead.ReadFunction, ADC_READ_INITIAL_DELAY,           \
-          ADC_READ_INTERVAL);
+          ADC_READ_INTERVAL, SCHEDULER_SHED_ADC_SCAN);
   scheduler.AddTask(faultIndication.Control, FAULT_INDICATION_INITIAL_DELAY,\
-          FAULT_INDICATION_INTERVAL);
+          FAULT_INDICATION_INTERVAL, SCHEDULER_SHED_NONE);
   scheduler.AddTask(modeCheck.Check, MODE_CHECK_INITIAL_DELAY,              \
-          MODE_CHECK_INTERVAL);
+          MODE_CHECK_INTERVAL, SCHEDULER_SHED_NONE);
   scheduler.AddTask(selfTest.RunTimeTest, SELFTEST_INITIAL_DELAY,           \
-          SELFTEST_INTERVAL);
+          SELFTEST_INTERVAL, SCHEDULER_SHED_BACKGROUND);
+#ifdef SCHEDULER_EVENT_TRIGGER
+  // Temperature control runs when the ADC scan is completed
+  scheduler.AddEventTask(tempControl.Control,                               \
+          TEMPERATURE_CONTROL_INITIAL_DELAY, TEMPERATURE_CONTROL_MAX_INTERVAL, \
+          SCHEDULER_SHED_NONE, SCHEDULER_EVENT_ADC_SCAN_COMPLETE);
+#else
   scheduler.AddTask(tempControl.Control, TEMPERATURE_CONTROL_INITIAL_DELAY, \
-          TEMPERATURE_CONTROL_INTERVAL);
+          TEMPERATURE_CONTROL_INTERVAL, SCHEDULER_SHED_NONE);
+#endif
 
 #ifdef DEBUG_MACRO
   scheduler.AddTask(Serial.DebugFunction, SERIAL_DEBUG_INITIAL_DELAY,       \
-          SERIAL_DEBUG_INTERVAL);
+          SERIAL_DEBUG_INTERVAL, SCHEDULER_SHED_BACKGROUND);
+#endif
 #endif
 
   while (1)
@@ -144,9 +174,22 @@ int main(void)
       scheduler.flags.interruptFLG = 0;
       scheduler.run();
 
+#ifdef SCHEDULER_TASK_WATCHDOG
+      // Reset watchdog timer only when all the tasks checked in on time
+      if ( scheduler.TasksAlive()) {
+        RESET_WATCHDOG();
+      }
+#else
       // Reset watchdog timer whenever tasks get executed
       RESET_WATCHDOG();
+#endif
     }
+#ifdef SCHEDULER_TICKLESS_IDLE
+    else {
+      // Keep the CPU in Idle till the next task is due
+      scheduler.WaitForTask();
+    }
+#endif
   }
   return 1; 
 }